@@ -0,0 +1,46 @@
+! GridTools
+!
+! Copyright (c) 2014-2019, ETH Zurich
+! All rights reserved.
+!
+! Please, refer to the LICENSE file in the root directory.
+! SPDX-License-Identifier: BSD-3-Clause
+
+! Compares the steady-state cost of passing a rank-3 array to a binding with passing a handle from gen_bind_array.
+program main
+    use iso_c_binding
+    use gen_handle
+    use gen_bound_array
+    use gen_benchmark_bound_array
+    implicit none
+    integer, parameter :: calls = 10000000
+    integer :: i
+    integer(8) :: start, finish, rate
+    real(c_double), dimension(8, 8, 8) :: field
+    type(c_ptr) :: bound
+    real(8) :: array_time, bound_time
+
+    field = 0
+
+    call system_clock(start, rate)
+    DO i=1, calls
+        call touch(field, real(i, c_double))
+    END DO
+    call system_clock(finish)
+    array_time = real(finish - start, 8) / rate / calls
+    if (field(8, 8, 8) /= calls) stop 1
+
+    call system_clock(start)
+    bound = gen_bind_array(field)
+    DO i=1, calls
+        call touch_bound(bound, real(-i, c_double))
+    END DO
+    call gen_release(bound)
+    call system_clock(finish)
+    bound_time = real(finish - start, 8) / rate / calls
+    if (field(8, 8, 8) /= -calls) stop 2
+
+    print '(a, i0, a)', 'binding with a rank-3 array, ', calls, ' calls'
+    print '(a, f8.2, a)', '  array:         ', 1e9 * array_time, ' ns/call'
+    print '(a, f8.2, a)', '  bound handle:  ', 1e9 * bound_time, ' ns/call'
+end
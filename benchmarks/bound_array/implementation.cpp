@@ -0,0 +1,22 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cpp_bindgen/export.hpp>
+
+namespace {
+    using field_t = double(&)[8][8][8];
+
+    // a kernel that is cheap compared to the setup of its rank-3 argument
+    void touch_impl(field_t field, double value) { field[7][7][7] = value; }
+    GEN_EXPORT_BINDING_WRAPPED_2(touch, touch_impl);
+
+    void touch_bound_impl(cpp_bindgen::bound_array<field_t> field, double value) { touch_impl(field, value); }
+    GEN_EXPORT_BINDING_2(touch_bound, touch_bound_impl);
+} // namespace
@@ -0,0 +1,62 @@
+! GridTools
+!
+! Copyright (c) 2014-2019, ETH Zurich
+! All rights reserved.
+!
+! Please, refer to the LICENSE file in the root directory.
+! SPDX-License-Identifier: BSD-3-Clause
+
+! Measures the overhead of calling a trivial scalar binding, once through the generated function calling the
+! implementation directly and once through the wrapper. The difference is largest in unoptimized builds. The overhead
+! of a small array binding, called through its Fortran wrapper, is measured too.
+program main
+    use iso_c_binding
+    use gen_benchmark_call_overhead
+    implicit none
+    integer, parameter :: calls = 2**27
+    real(8) :: elided_time, wrapped_time, array_time
+
+    wrapped_time = run(.false.)
+    elided_time = run(.true.)
+    array_time = run_array()
+    print '(a)', '  wrapped ns/call   elided ns/call   speedup    array ns/call'
+    print '(f17.2, f17.2, f10.2, f17.2)', 1e9 * wrapped_time, 1e9 * elided_time, wrapped_time / elided_time, &
+        1e9 * array_time
+contains
+    real(8) function run(elided)
+        logical, intent(in) :: elided
+        real(c_double) :: y
+        integer :: i
+        integer(8) :: start, finish, rate
+
+        y = 0
+        call system_clock(start, rate)
+        if (elided) then
+            DO i=1, calls
+                y = axpy_elided(0.5_c_double, y, 1._c_double)
+            END DO
+        else
+            DO i=1, calls
+                y = axpy_wrapped(0.5_c_double, y, 1._c_double)
+            END DO
+        end if
+        call system_clock(finish)
+        if (abs(y - 2) > 1e-12) stop 1
+        run = real(finish - start, 8) / rate / calls
+    end function
+
+    real(8) function run_array()
+        real(c_double), dimension(4) :: x
+        integer :: i
+        integer(8) :: start, finish, rate
+
+        x = 0
+        call system_clock(start, rate)
+        DO i=1, calls
+            call shift(x, 1._c_double)
+        END DO
+        call system_clock(finish)
+        if (any(x /= calls)) stop 2
+        run_array = real(finish - start, 8) / rate / calls
+    end function
+end
@@ -0,0 +1,26 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cpp_bindgen/export.hpp>
+
+double axpy_impl(double a, double x, double y) noexcept;
+void shift_impl(double (&x)[4], double a) noexcept;
+
+// the signature is made of arithmetic values only: the generated function calls axpy_impl directly
+GEN_EXPORT_BINDING_3(axpy_elided, axpy_impl);
+
+// the same binding going through the wrapper, as the generated functions did before the elision
+GEN_ADD_GENERATED_DECLARATION(double(double, double, double), axpy_wrapped);
+extern "C" GEN_EXPORT_VISIBILITY double axpy_wrapped(double a, double x, double y) {
+    return cpp_bindgen::wrap<double(double, double, double)>(axpy_impl)(a, x, y);
+}
+
+// a small array passed through the Fortran wrapper and its descriptor
+GEN_EXPORT_BINDING_WRAPPED_2(shift, shift_impl);
@@ -0,0 +1,16 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+double axpy_impl(double a, double x, double y) noexcept { return a * x + y; }
+
+void shift_impl(double (&x)[4], double a) noexcept {
+    for (double &elem : x)
+        elem += a;
+}
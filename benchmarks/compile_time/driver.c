@@ -0,0 +1,73 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+// Compiles translation units with a growing number of bindings, as a library (CPP_BINDGEN_NO_DECLARATIONS) and as
+// its generator (CPP_BINDGEN_DECLARATIONS), and reports the wall time and the peak memory of the compiler.
+
+#define _DEFAULT_SOURCE
+
+#include <spawn.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <time.h>
+
+extern char **environ;
+
+static const int runs = 3;
+static const int sizes[] = {SIZES};
+
+static double now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+// the best wall time of compiling the bindings of the given size, the peak memory (kB) is stored in `peak_rss`
+static double compile_time(int size, char *definition, long *peak_rss) {
+    char source[4096];
+    snprintf(source, sizeof(source), BINARY_DIR "/bindings%d.cpp", size);
+    char *argv[] = {COMPILER, "@" BINARY_DIR "/flags.rsp", definition, "-c", source, "-o", "/dev/null", NULL};
+    double res = 0;
+    *peak_rss = 0;
+    for (int i = 0; i < runs; ++i) {
+        pid_t pid;
+        int status;
+        struct rusage usage;
+        double start = now();
+        if (posix_spawn(&pid, COMPILER, NULL, NULL, argv, environ) || wait4(pid, &status, 0, &usage) < 0 || status)
+            exit(1);
+        double elapsed = now() - start;
+        if (!i || elapsed < res)
+            res = elapsed;
+        // the compiler proper is a child of the driver, the usage of the waited for children is included
+        if (usage.ru_maxrss > *peak_rss)
+            *peak_rss = usage.ru_maxrss;
+    }
+    return res;
+}
+
+int main() {
+    printf("           library               generator\n");
+    printf("bindings   time s   peak MB      time s   peak MB\n");
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+        long library_rss, generator_rss;
+        double library = compile_time(sizes[i], "-DCPP_BINDGEN_NO_DECLARATIONS", &library_rss);
+        double generator = compile_time(sizes[i], "-DCPP_BINDGEN_DECLARATIONS", &generator_rss);
+        printf("%8d %8.2f %9.1f %11.2f %9.1f\n",
+            sizes[i],
+            library,
+            library_rss / 1024.,
+            generator,
+            generator_rss / 1024.);
+    }
+    return 0;
+}
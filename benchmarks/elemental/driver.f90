@@ -0,0 +1,74 @@
+! GridTools
+!
+! Copyright (c) 2014-2019, ETH Zurich
+! All rights reserved.
+!
+! Please, refer to the LICENSE file in the root directory.
+! SPDX-License-Identifier: BSD-3-Clause
+
+! Compares calling the scalar variant of elemental bindings once per grid point with a single call of the array variant.
+program main
+    use iso_c_binding
+    use gen_benchmark_elemental
+    implicit none
+    integer, parameter :: ie = 128, je = 128, ke = 80, repetitions = 10
+    integer :: i, j, k, r
+    integer(8) :: start, finish, rate
+    real(c_double), dimension(ie, je, ke) :: t, qv, per_element, whole_array
+    real(8) :: per_element_time, whole_array_time
+
+    call random_number(t)
+    call random_number(qv)
+    t = 250 + 50 * t
+    qv = 0.02 * qv
+
+    call system_clock(start, rate)
+    DO r=1, repetitions
+        DO k=1, ke
+            DO j=1, je
+                DO i=1, ie
+                    per_element(i,j,k) = virtual_temperature(t(i,j,k), qv(i,j,k))
+                END DO
+            END DO
+        END DO
+    END DO
+    call system_clock(finish)
+    per_element_time = real(finish - start, 8) / rate / repetitions
+
+    call system_clock(start)
+    DO r=1, repetitions
+        whole_array = virtual_temperature(t, qv)
+    END DO
+    call system_clock(finish)
+    whole_array_time = real(finish - start, 8) / rate / repetitions
+
+    if (any(per_element /= whole_array)) stop 1
+    print '(a, i0, a)', 'virtual_temperature on ', ie * je * ke, ' points'
+    print '(a, f10.3, a)', '  per-element calls: ', 1e3 * per_element_time, ' ms'
+    print '(a, f10.3, a)', '  array variant:     ', 1e3 * whole_array_time, ' ms'
+
+    call system_clock(start)
+    DO r=1, repetitions
+        DO k=1, ke
+            DO j=1, je
+                DO i=1, ie
+                    per_element(i,j,k) = saturation_vapour_pressure(t(i,j,k))
+                END DO
+            END DO
+        END DO
+    END DO
+    call system_clock(finish)
+    per_element_time = real(finish - start, 8) / rate / repetitions
+
+    call system_clock(start)
+    DO r=1, repetitions
+        whole_array = saturation_vapour_pressure(t)
+    END DO
+    call system_clock(finish)
+    whole_array_time = real(finish - start, 8) / rate / repetitions
+
+    if (any(abs(per_element - whole_array) > 1e-12 * abs(per_element))) stop 2
+    print '(a, i0, a)', 'saturation_vapour_pressure on ', ie * je * ke, ' points'
+    print '(a, f10.3, a)', '  per-element calls: ', 1e3 * per_element_time, ' ms'
+    print '(a, f10.3, a)', '  array variant:     ', 1e3 * whole_array_time, ' ms'
+end
@@ -0,0 +1,24 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cmath>
+
+#include <cpp_bindgen/export.hpp>
+
+namespace {
+    // saturation vapour pressure over water (Magnus formula)
+    double saturation_vapour_pressure_impl(double t) { return 610.78 * std::exp(17.27 * (t - 273.15) / (t - 35.86)); }
+
+    GEN_EXPORT_ELEMENTAL_BINDING(1, saturation_vapour_pressure, saturation_vapour_pressure_impl);
+
+    double virtual_temperature_impl(double t, double qv) { return t * (1. + 0.608 * qv); }
+
+    GEN_EXPORT_ELEMENTAL_BINDING(2, virtual_temperature, virtual_temperature_impl);
+} // namespace
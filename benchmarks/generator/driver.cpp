@@ -0,0 +1,47 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+
+#include <sys/resource.h>
+
+#include <cpp_bindgen/generator.hpp>
+
+namespace {
+    long peak_rss_kb() {
+        rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+        return usage.ru_maxrss;
+    }
+
+    template <class F>
+    void measure(char const *name, F fun) {
+        auto start = std::chrono::steady_clock::now();
+        fun();
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        std::printf("%-8s %8.3f s, peak rss %7ld kB\n", name, elapsed.count(), peak_rss_kb());
+    }
+} // namespace
+
+// gen_benchmark_generator [<directory>]: writes the header and the module of the synthetic library to <directory>
+int main(int argc, char const *argv[]) {
+    std::string dir = argc > 1 ? argv[1] : ".";
+    std::printf("%-8s %10s  peak rss %7ld kB\n", "start", "", peak_rss_kb());
+    measure("c", [&] {
+        std::ofstream strm(dir + "/gen_benchmark_generator.h");
+        cpp_bindgen::generate_c_interface(strm);
+    });
+    measure("fortran", [&] {
+        std::ofstream strm(dir + "/gen_benchmark_generator.f90");
+        cpp_bindgen::generate_fortran_interface(strm, "gen_benchmark_generator");
+    });
+}
@@ -0,0 +1,54 @@
+! GridTools
+!
+! Copyright (c) 2014-2019, ETH Zurich
+! All rights reserved.
+!
+! Please, refer to the LICENSE file in the root directory.
+! SPDX-License-Identifier: BSD-3-Clause
+
+! Strong scaling of a parallel binding on a 256x256x128 field, from 1 thread to the number of threads given as the
+! first argument (default 8).
+program main
+    use iso_c_binding
+    use gen_parallel
+    use gen_benchmark_parallel
+    implicit none
+    integer, parameter :: ni = 256, nj = 256, nk = 128, calls = 20
+    integer :: i, threads, max_threads
+    integer(8) :: start, finish, rate
+    character(len=16) :: arg
+    real(c_double), dimension(:, :, :), allocatable :: in, out
+    real(8) :: time, serial_time
+
+    max_threads = 8
+    if (command_argument_count() > 0) then
+        call get_command_argument(1, arg)
+        read (arg, *) max_threads
+    end if
+
+    print '(a, i0, a, i0, a, i0, a)', 'parallel binding on a ', ni, 'x', nj, 'x', nk, ' field'
+    print '(a)', '  threads   ms/call   speedup'
+    threads = 1
+    DO WHILE (threads <= max_threads)
+        call gen_set_parallel_num_threads(threads)
+        ! the pages are first touched by the threads that will process their tiles
+        allocate(in(ni, nj, nk), out(ni, nj, nk))
+        call laplacian(in, out)
+        call laplacian(out, in)
+        in = 1
+        out = 0
+
+        call system_clock(start, rate)
+        DO i=1, calls
+            call laplacian(out, in)
+        END DO
+        call system_clock(finish)
+        time = real(finish - start, 8) / rate / calls
+        if (threads == 1) serial_time = time
+        if (out(2, 2, nk) /= 0) stop 1
+
+        print '(i9, f10.3, f10.2)', threads, 1e3 * time, serial_time / time
+        deallocate(in, out)
+        threads = threads * 2
+    END DO
+end
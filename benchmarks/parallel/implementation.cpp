@@ -0,0 +1,27 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cpp_bindgen/export.hpp>
+
+namespace {
+    using field_t = cpp_bindgen::descriptor_view<double, 3>;
+
+    // a horizontal five point stencil, written for a block of k-levels
+    void laplacian_impl(field_t out, field_t const in) {
+        int ni = in.extent(0);
+        int nj = in.extent(1);
+        for (int k = 0; k < in.extent(2); ++k)
+            for (int j = 1; j < nj - 1; ++j)
+                for (int i = 1; i < ni - 1; ++i)
+                    out(i, j, k) =
+                        4 * in(i, j, k) - in(i - 1, j, k) - in(i + 1, j, k) - in(i, j - 1, k) - in(i, j + 1, k);
+    }
+    GEN_EXPORT_PARALLEL_BINDING_WRAPPED(2, laplacian, laplacian_impl);
+} // namespace
@@ -0,0 +1,65 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+// Compares the startup of a program linking 10k bindings with the startup of the same program without bindings.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <spawn.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/wait.h>
+#include <time.h>
+
+extern char **environ;
+
+static const int runs = 100;
+
+static double now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+// the average wall time of running `path`, its output is discarded
+static double startup_time(char *path) {
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_addopen(&actions, 1, "/dev/null", 1, 0);
+    char *argv[] = {path, NULL};
+    double start = now();
+    for (int i = 0; i < runs; ++i) {
+        pid_t pid;
+        int status;
+        if (posix_spawn(&pid, path, &actions, NULL, argv, environ) || waitpid(pid, &status, 0) < 0 || status)
+            exit(1);
+    }
+    double res = (now() - start) / runs;
+    posix_spawn_file_actions_destroy(&actions);
+    return res;
+}
+
+static long long heap(char const *path) {
+    long long res = -1;
+    FILE *output = popen(path, "r");
+    if (!output || fscanf(output, "%lld", &res) != 1 || pclose(output))
+        exit(1);
+    return res;
+}
+
+int main() {
+    startup_time(LOAD);
+    double empty = startup_time(LOAD_EMPTY);
+    double bindings = startup_time(LOAD);
+    printf("               startup ms   heap bytes\n");
+    printf("no bindings  %12.3f %12lld\n", 1e3 * empty, heap(LOAD_EMPTY));
+    printf("10k bindings %12.3f %12lld\n", 1e3 * bindings, heap(LOAD));
+    return 0;
+}
@@ -0,0 +1,19 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <malloc.h>
+#include <stdio.h>
+
+// prints the heap allocated before main, i.e. by the static initialization of the linked libraries
+int main() {
+    struct mallinfo2 info = mallinfo2();
+    printf("%zu\n", info.uordblks);
+    return 0;
+}
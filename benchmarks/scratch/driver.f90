@@ -0,0 +1,54 @@
+! GridTools
+!
+! Copyright (c) 2014-2019, ETH Zurich
+! All rights reserved.
+!
+! Please, refer to the LICENSE file in the root directory.
+! SPDX-License-Identifier: BSD-3-Clause
+
+! Compares a binding allocating its temporary buffer with std::vector on every call to the same binding taking the
+! buffer from the injected scratch arena. With OpenMP the calls are distributed over the threads.
+program main
+    use iso_c_binding
+    use gen_benchmark_scratch
+    implicit none
+    integer, parameter :: total = 2**26
+    integer :: n, calls
+    real(8) :: vector_time, scratch_time
+
+    print '(a)', '        n   vector ns/call   scratch ns/call   speedup'
+    n = 16
+    DO WHILE (n <= 2**16)
+        calls = total / n
+        vector_time = run(.false.)
+        scratch_time = run(.true.)
+        print '(i9, f17.1, f18.1, f10.2)', n, 1e9 * vector_time, 1e9 * scratch_time, vector_time / scratch_time
+        n = n * 16
+    END DO
+contains
+    real(8) function run(use_scratch)
+        logical, intent(in) :: use_scratch
+        real(c_double), dimension(:), allocatable :: in, out
+        integer :: i
+        integer(8) :: start, finish, rate
+
+        call system_clock(start, rate)
+        !$omp parallel private(in, out, i)
+        allocate(in(n), out(n))
+        in = 1
+        !$omp do schedule(static)
+        DO i=1, calls
+            if (use_scratch) then
+                call smooth_scratch(out, in)
+            else
+                call smooth_vector(out, in)
+            end if
+        END DO
+        !$omp end do
+        if (abs(out(n / 2) - 1) > 1e-12) stop 1
+        deallocate(in, out)
+        !$omp end parallel
+        call system_clock(finish)
+        run = real(finish - start, 8) / rate / calls
+    end function
+end
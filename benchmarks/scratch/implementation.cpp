@@ -0,0 +1,41 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <vector>
+
+#include <cpp_bindgen/export.hpp>
+
+namespace {
+    using field_t = cpp_bindgen::descriptor_view<double, 1>;
+
+    // two passes of a three point average, the first pass goes to the temporary buffer `tmp`
+    void smooth(field_t out, field_t const in, double *tmp) {
+        int n = in.extent(0);
+        tmp[0] = in[0];
+        tmp[n - 1] = in[n - 1];
+        for (int i = 1; i < n - 1; ++i)
+            tmp[i] = (in[i - 1] + in[i] + in[i + 1]) / 3;
+        out[0] = tmp[0];
+        out[n - 1] = tmp[n - 1];
+        for (int i = 1; i < n - 1; ++i)
+            out[i] = (tmp[i - 1] + tmp[i] + tmp[i + 1]) / 3;
+    }
+
+    void smooth_vector_impl(field_t out, field_t const in) {
+        std::vector<double> tmp(in.size());
+        smooth(out, in, tmp.data());
+    }
+    GEN_EXPORT_BINDING_WRAPPED(2, smooth_vector, smooth_vector_impl);
+
+    void smooth_scratch_impl(field_t out, field_t const in, cpp_bindgen::scratch &arena) {
+        smooth(out, in, arena.allocate<double>(in.size()));
+    }
+    GEN_EXPORT_BINDING_WRAPPED(2, smooth_scratch, smooth_scratch_impl);
+} // namespace
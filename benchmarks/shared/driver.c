@@ -0,0 +1,98 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+// Compares a library built with the SHARED option of cpp_bindgen_add_library() with the same library exporting all
+// its symbols: the symbols exported by the libraries, the relocations the dynamic linker processes to load them and
+// the time it takes.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <elf.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const int runs = 200;
+
+struct elf_stats {
+    long exported;
+    long relocations;
+    long plt_relocations;
+};
+
+// the defined symbols of the dynamic symbol table and the relocations of a 64-bit ELF shared library
+static struct elf_stats elf_stats(char const *path) {
+    struct elf_stats res = {0, 0, 0};
+    FILE *file = fopen(path, "rb");
+    if (!file)
+        exit(1);
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    char *image = malloc(size);
+    rewind(file);
+    if (!image || fread(image, 1, size, file) != (size_t)size)
+        exit(1);
+    fclose(file);
+
+    Elf64_Ehdr const *header = (Elf64_Ehdr const *)image;
+    if (memcmp(header->e_ident, ELFMAG, SELFMAG) || header->e_ident[EI_CLASS] != ELFCLASS64)
+        exit(1);
+    Elf64_Shdr const *sections = (Elf64_Shdr const *)(image + header->e_shoff);
+    char const *names = image + sections[header->e_shstrndx].sh_offset;
+    for (int i = 0; i < header->e_shnum; ++i) {
+        Elf64_Shdr const *section = &sections[i];
+        if (section->sh_type == SHT_DYNSYM) {
+            Elf64_Sym const *symbols = (Elf64_Sym const *)(image + section->sh_offset);
+            for (size_t j = 0; j < section->sh_size / sizeof(Elf64_Sym); ++j)
+                if (symbols[j].st_shndx != SHN_UNDEF)
+                    ++res.exported;
+        } else if (section->sh_type == SHT_RELA || section->sh_type == SHT_REL) {
+            long count = section->sh_size / section->sh_entsize;
+            res.relocations += count;
+            if (!strcmp(names + section->sh_name, ".rela.plt") || !strcmp(names + section->sh_name, ".rel.plt"))
+                res.plt_relocations += count;
+        }
+    }
+    free(image);
+    return res;
+}
+
+// the average time in ms to load `library` with all its symbols bound, in a new process each time
+static double load_time(char const *library) {
+    char command[4096];
+    snprintf(command, sizeof command, "%s %s", LOAD, library);
+    double res = 0;
+    for (int i = 0; i < runs; ++i) {
+        double us;
+        FILE *output = popen(command, "r");
+        if (!output || fscanf(output, "%lf", &us) != 1 || pclose(output))
+            exit(1);
+        res += us;
+    }
+    return 1e-3 * res / runs;
+}
+
+static void print(char const *name, char const *library) {
+    struct elf_stats stats = elf_stats(library);
+    printf("%-10s %10ld %12ld %8ld %10.3f\n",
+        name,
+        stats.exported,
+        stats.relocations,
+        stats.plt_relocations,
+        load_time(library));
+}
+
+int main() {
+    load_time(LIBRARY);
+    printf("           exported  relocations   of PLT    load ms\n");
+    print("default", LIBRARY_DEFAULT);
+    print("SHARED", LIBRARY);
+    return 0;
+}
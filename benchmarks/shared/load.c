@@ -0,0 +1,32 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <dlfcn.h>
+#include <stdio.h>
+#include <time.h>
+
+// prints the time in microseconds to load the library `argv[1]` and bind all its symbols, then calls a binding
+int main(int argc, char *argv[]) {
+    if (argc < 2)
+        return 1;
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    void *library = dlopen(argv[1], RTLD_NOW | RTLD_LOCAL);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    if (!library)
+        return 1;
+    double (*binding)(double) = (double (*)(double))dlsym(library, "gen_scalar_9_199");
+    if (!binding || binding(1) != 208)
+        return 1;
+    printf("%f\n", 1e6 * (end.tv_sec - start.tv_sec) + 1e-3 * (end.tv_nsec - start.tv_nsec));
+    return 0;
+}
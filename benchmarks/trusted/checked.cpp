@@ -0,0 +1,15 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cpp_bindgen/export.hpp>
+
+#include "kernel.hpp"
+
+GEN_EXPORT_BINDING_2(shift_corner_checked, shift_corner_impl);
@@ -0,0 +1,70 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+// Compares the per-call cost of a binding taking rank-3 arrays with and without the TRUSTED option.
+// Build with NDEBUG (e.g. CMAKE_BUILD_TYPE=Release), otherwise trusted bindings still assert the array shapes.
+
+#include <stdio.h>
+#include <time.h>
+
+#include "gen_benchmark_checked.h"
+#include "gen_benchmark_trusted.h"
+
+enum { calls = 10000000 };
+
+static double now() {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+static gen_fortran_array_descriptor make_descriptor(double *data) {
+    gen_fortran_array_descriptor descriptor;
+    descriptor.type = gen_fk_Double;
+    descriptor.rank = 3;
+    descriptor.dims[0] = 8;
+    descriptor.dims[1] = 8;
+    descriptor.dims[2] = 8;
+    descriptor.data = data;
+    descriptor.is_acc_present = false;
+    return descriptor;
+}
+
+int main() {
+    static double in[8 * 8 * 8], out[8 * 8 * 8];
+    gen_fortran_array_descriptor in_descriptor = make_descriptor(in);
+    gen_fortran_array_descriptor out_descriptor = make_descriptor(out);
+    double start, checked, trusted;
+    int i;
+
+    start = now();
+    for (i = 0; i < calls; ++i) {
+        in[0] = i;
+        shift_corner_checked(&out_descriptor, &in_descriptor);
+    }
+    checked = (now() - start) / calls;
+    if (out[8 * 8 * 8 - 1] != calls - 1)
+        return 1;
+
+    start = now();
+    for (i = 0; i < calls; ++i) {
+        in[0] = i;
+        shift_corner_trusted(&out_descriptor, &in_descriptor);
+    }
+    trusted = (now() - start) / calls;
+    if (out[8 * 8 * 8 - 1] != calls - 1)
+        return 1;
+
+    printf("binding with two rank-3 arrays, %d calls\n", calls);
+    printf("  checked: %8.2f ns/call\n", 1e9 * checked);
+    printf("  trusted: %8.2f ns/call\n", 1e9 * trusted);
+    printf("  savings: %8.2f ns/call\n", 1e9 * (checked - trusted));
+    return 0;
+}
@@ -0,0 +1,15 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+namespace {
+    // a kernel that is cheap compared to the validation of its rank-3 arguments
+    void shift_corner_impl(double (&out)[8][8][8], double const (&in)[8][8][8]) { out[7][7][7] = in[0][0][0]; }
+} // namespace
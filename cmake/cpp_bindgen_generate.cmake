@@ -27,17 +27,77 @@ set(new_BINDINGS_C_DECL_FILENAME ${generator_dir}/${filename_BINDINGS_C_DECL_FIL
 get_filename_component(filename_BINDINGS_FORTRAN_DECL_FILENAME ${BINDINGS_FORTRAN_DECL_FILENAME} NAME)
 set(new_BINDINGS_FORTRAN_DECL_FILENAME ${generator_dir}/${filename_BINDINGS_FORTRAN_DECL_FILENAME})
 
-# run generator
-execute_process(COMMAND ${GENERATOR} ${new_BINDINGS_C_DECL_FILENAME} ${new_BINDINGS_FORTRAN_DECL_FILENAME} ${FORTRAN_MODULE_NAME}
+# the generated files besides the C header: the Fortran module, its submodules (see FORTRAN_SUBMODULES), the
+# version script of the SHARED libraries (see VERSION_SCRIPT) and the dispatch tables (see DISPATCH_NAME)
+set(generated_files ${BINDINGS_FORTRAN_DECL_FILENAME})
+set(new_generated_files ${new_BINDINGS_FORTRAN_DECL_FILENAME})
+set(generator_args)
+if(FORTRAN_SUBMODULES GREATER 0)
+    set(generator_args ${FORTRAN_SUBMODULES})
+    foreach(i RANGE 1 ${FORTRAN_SUBMODULES})
+        string(REGEX REPLACE "(\\.[^./]+)$" "_${i}\\1" submodule_file ${BINDINGS_FORTRAN_DECL_FILENAME})
+        list(APPEND generated_files ${submodule_file})
+        string(REGEX REPLACE "(\\.[^./]+)$" "_${i}\\1" submodule_file ${new_BINDINGS_FORTRAN_DECL_FILENAME})
+        list(APPEND new_generated_files ${submodule_file})
+    endforeach()
+endif()
+if(VERSION_SCRIPT)
+    get_filename_component(filename_VERSION_SCRIPT ${VERSION_SCRIPT} NAME)
+    set(new_VERSION_SCRIPT ${generator_dir}/${filename_VERSION_SCRIPT})
+    list(APPEND generator_args --version-script=${new_VERSION_SCRIPT})
+    list(APPEND generated_files ${VERSION_SCRIPT})
+    list(APPEND new_generated_files ${new_VERSION_SCRIPT})
+endif()
+if(DISPATCH_NAME)
+    list(APPEND generator_args --dispatch=${DISPATCH_NAME})
+    foreach(file ${BINDINGS_C_DECL_FILENAME} ${BINDINGS_FORTRAN_DECL_FILENAME})
+        string(REGEX REPLACE "(\\.[^./]+)$" "_dispatch\\1" dispatch_file ${file})
+        list(APPEND generated_files ${dispatch_file})
+    endforeach()
+    foreach(file ${new_BINDINGS_C_DECL_FILENAME} ${new_BINDINGS_FORTRAN_DECL_FILENAME})
+        string(REGEX REPLACE "(\\.[^./]+)$" "_dispatch\\1" dispatch_file ${file})
+        list(APPEND new_generated_files ${dispatch_file})
+    endforeach()
+endif()
+
+# run generator, the generator tool gets the library to load first (see CPP_BINDGEN_GENERATOR_TOOL)
+execute_process(COMMAND ${GENERATOR} ${GENERATOR_LIBRARY} ${new_BINDINGS_C_DECL_FILENAME} ${new_BINDINGS_FORTRAN_DECL_FILENAME} ${FORTRAN_MODULE_NAME}
+    ${generator_args}
     RESULT_VARIABLE generate_result
     OUTPUT_VARIABLE generate_out
     ERROR_VARIABLE generate_out
     )
 
 if(${generate_result} STREQUAL "0")
-    # only update the bindings if they changed (file not touched -> no rebuild is triggered)
-    check_and_update(${BINDINGS_C_DECL_FILENAME} ${new_BINDINGS_C_DECL_FILENAME})
-    check_and_update(${BINDINGS_FORTRAN_DECL_FILENAME} ${new_BINDINGS_FORTRAN_DECL_FILENAME})
+    file(SHA256 ${new_BINDINGS_C_DECL_FILENAME} bindings_hash)
+    set(bindings_exist TRUE)
+    foreach(file IN LISTS new_generated_files)
+        file(SHA256 ${file} file_hash)
+        string(APPEND bindings_hash " ${file_hash}")
+    endforeach()
+    foreach(file ${BINDINGS_C_DECL_FILENAME} ${generated_files})
+        if(NOT EXISTS ${file})
+            set(bindings_exist FALSE)
+        endif()
+    endforeach()
+    if(EXISTS ${BINDINGS_STAMP})
+        file(READ ${BINDINGS_STAMP} previous_bindings_hash)
+    endif()
+    if(bindings_hash STREQUAL previous_bindings_hash AND bindings_exist)
+        # the exported signatures did not change since the last run, the bindings are not touched
+        message(STATUS "Bindings of ${FORTRAN_MODULE_NAME} are unchanged")
+        file(REMOVE ${new_BINDINGS_C_DECL_FILENAME} ${new_generated_files})
+    else()
+        # only update the bindings if they changed (file not touched -> no rebuild is triggered)
+        check_and_update(${BINDINGS_C_DECL_FILENAME} ${new_BINDINGS_C_DECL_FILENAME})
+        foreach(file IN LISTS generated_files)
+            list(FIND generated_files ${file} i)
+            list(GET new_generated_files ${i} new_file)
+            check_and_update(${file} ${new_file})
+        endforeach()
+    endif()
+    # always rewritten: the stamp is the output of the build rule running this script
+    file(WRITE ${BINDINGS_STAMP} "${bindings_hash}")
 else()
     message(FATAL_ERROR "GENERATING BINDINGS FAILED. Possibly you cross-compiled the bindings generator for a target "
         " which cannot be executed on this host. Consider using the cross-compilation option.\n Exit code: ${generate_result}\n${generate_out}")
@@ -52,9 +52,26 @@ set(CMAKE_SOURCES
 set(CBINDINGS_SOURCES
     "${PROJECT_SOURCE_DIR}/src/cpp_bindgen/generator.cpp"
     "${PROJECT_SOURCE_DIR}/src/cpp_bindgen/generator_main.cpp"
+    "${PROJECT_SOURCE_DIR}/src/cpp_bindgen/generator_library.cpp"
+    "${PROJECT_SOURCE_DIR}/src/cpp_bindgen/generator_tool.cpp"
     "${PROJECT_SOURCE_DIR}/src/cpp_bindgen/array_descriptor.f90"
     "${PROJECT_SOURCE_DIR}/src/cpp_bindgen/handle.f90"
     "${PROJECT_SOURCE_DIR}/src/cpp_bindgen/handle.cpp"
+    "${PROJECT_SOURCE_DIR}/src/cpp_bindgen/async.f90"
+    "${PROJECT_SOURCE_DIR}/src/cpp_bindgen/async.cpp"
+    "${PROJECT_SOURCE_DIR}/src/cpp_bindgen/bound_array.f90"
+    "${PROJECT_SOURCE_DIR}/src/cpp_bindgen/bound_array.cpp"
+    "${PROJECT_SOURCE_DIR}/src/cpp_bindgen/dispatch.f90"
+    "${PROJECT_SOURCE_DIR}/src/cpp_bindgen/dispatch.cpp"
+    "${PROJECT_SOURCE_DIR}/src/cpp_bindgen/parallel.f90"
+    "${PROJECT_SOURCE_DIR}/src/cpp_bindgen/parallel.cpp"
+    "${PROJECT_SOURCE_DIR}/src/cpp_bindgen/profile.f90"
+    "${PROJECT_SOURCE_DIR}/src/cpp_bindgen/profile.cpp"
+    "${PROJECT_SOURCE_DIR}/src/cpp_bindgen/queue.f90"
+    "${PROJECT_SOURCE_DIR}/src/cpp_bindgen/queue.cpp"
+    "${PROJECT_SOURCE_DIR}/src/cpp_bindgen/scratch.cpp"
+    "${PROJECT_SOURCE_DIR}/src/cpp_bindgen/trace.f90"
+    "${PROJECT_SOURCE_DIR}/src/cpp_bindgen/trace.cpp"
     )
 
 install(DIRECTORY include/ DESTINATION include)
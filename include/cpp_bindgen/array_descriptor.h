@@ -50,3 +50,55 @@ typedef struct gen_fortran_array_descriptor gen_fortran_array_descriptor;
 #ifdef CPP_BINDGEN_GT_LEGACY // remove once GT is at v2.0
 typedef struct gen_fortran_array_descriptor gt_fortran_array_descriptor;
 #endif
+
+/*
+ *  Describes the contiguous C array at `data` with the `rank` extents `c_extents` given in C order, outermost first.
+ *  The extents of the descriptor are in Fortran order, i.e. reversed: `double field[nk][nj][ni]` is passed as a
+ *  Fortran array of shape (ni, nj, nk).
+ */
+static inline gen_fortran_array_descriptor gen_c_array_descriptor(
+    gen_fortran_array_kind type, int rank, int const *c_extents, void *data) {
+    gen_fortran_array_descriptor res;
+    int i;
+    res.type = type;
+    res.rank = rank;
+    for (i = 0; i < 7; ++i)
+        res.dims[i] = i < rank ? c_extents[rank - 1 - i] : 0;
+    res.data = data;
+    res.is_acc_present = false;
+    return res;
+}
+
+#if !defined(__cplusplus) && defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+/* The gen_fortran_array_kind of the type of `element`. */
+#define GEN_FORTRAN_ARRAY_KIND(element) \
+    _Generic((element),                 \
+        bool: gen_fk_Bool,              \
+        int: gen_fk_Int,                \
+        short: gen_fk_Short,            \
+        long: gen_fk_Long,              \
+        long long: gen_fk_LongLong,     \
+        float: gen_fk_Float,            \
+        double: gen_fk_Double,          \
+        long double: gen_fk_LongDouble, \
+        signed char: gen_fk_SignedChar)
+
+#define GEN_C_ARRAY_EXTENT(array) (int)(sizeof(array) / sizeof((array)[0]))
+
+/*
+ *  The descriptors of (variable length) arrays of rank 1 to 3, e.g. `double field[nk][nj][ni]` is described by
+ *  `GEN_C_ARRAY_DESCRIPTOR3(field)`. The argument must be an array, not a pointer.
+ */
+#define GEN_C_ARRAY_DESCRIPTOR1(array) \
+    gen_c_array_descriptor(GEN_FORTRAN_ARRAY_KIND((array)[0]), 1, (int[]){GEN_C_ARRAY_EXTENT(array)}, (array))
+#define GEN_C_ARRAY_DESCRIPTOR2(array)                                      \
+    gen_c_array_descriptor(GEN_FORTRAN_ARRAY_KIND((array)[0][0]),           \
+        2,                                                                  \
+        (int[]){GEN_C_ARRAY_EXTENT(array), GEN_C_ARRAY_EXTENT((array)[0])}, \
+        (array))
+#define GEN_C_ARRAY_DESCRIPTOR3(array)                                                                         \
+    gen_c_array_descriptor(GEN_FORTRAN_ARRAY_KIND((array)[0][0][0]),                                           \
+        3,                                                                                                     \
+        (int[]){GEN_C_ARRAY_EXTENT(array), GEN_C_ARRAY_EXTENT((array)[0]), GEN_C_ARRAY_EXTENT((array)[0][0])}, \
+        (array))
+#endif
@@ -0,0 +1,42 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <stdbool.h>
+
+#include "handle.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *  Blocks until the asynchronous call behind the future handle `future` has finished.
+ *
+ *  Returns a handle to the result of the call (which has to be released with gen_release()) or a null pointer if the
+ *  exported function returns `void`. If the call failed, the stored exception is rethrown. The future handle itself
+ *  still has to be released with gen_release(); it can be waited for only once.
+ */
+gen_handle *gen_wait(gen_handle *future);
+
+/// Returns true if the asynchronous call behind the future handle `future` has finished, i.e. gen_wait() won't block.
+bool gen_test(gen_handle *future);
+
+/**
+ *  Sets the number of worker threads executing asynchronous calls.
+ *
+ *  The default is taken from the environment variable GEN_ASYNC_NUM_THREADS or, if it is not set, from the number of
+ *  hardware threads. Calls that are already queued are finished by the previous workers before this function returns.
+ */
+void gen_set_async_num_threads(int num_threads);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,148 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <functional>
+#include <future>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "common/any_moveable.hpp"
+#include "common/make_indices.hpp"
+#include "common/type_traits.hpp"
+
+#include "async.h"
+#include "function_wrapper.hpp"
+#include "handle_impl.hpp"
+
+namespace cpp_bindgen {
+
+    /// Executes `task` on the worker pool of the asynchronous bindings.
+    void async_execute(std::function<void()> task);
+
+    /// The object held by the future handles returned by asynchronous bindings.
+    using async_future = std::future<any_moveable>;
+
+    namespace _impl {
+        template <class T>
+        struct async_signature;
+
+        template <class R, class... Params>
+        struct async_signature<R(Params...)> {
+            using type = async_future(Params...);
+        };
+
+        template <class R>
+        struct invoke_async_impl_f {
+            template <class Impl, class... Args>
+            any_moveable operator()(Impl &impl, Args &&... args) const {
+                return any_moveable(impl(std::forward<Args>(args)...));
+            }
+        };
+
+        template <>
+        struct invoke_async_impl_f<void> {
+            template <class Impl, class... Args>
+            any_moveable operator()(Impl &impl, Args &&... args) const {
+                impl(std::forward<Args>(args)...);
+                return {};
+            }
+        };
+
+        /**
+         * How the argument for a parameter of type `T` is stored until the call is executed. References to the
+         * objects behind handles, to C arrays and to written scalars are kept, they refer to memory that the caller
+         * keeps valid. The other array views and the values of const scalar references are copied, as they may refer
+         * to temporaries of the generated function and its Fortran wrapper.
+         */
+        template <class T, class = void>
+        struct async_arg {
+            using type = T;
+            template <class Arg>
+            static type convert(Arg arg) {
+                return convert_from_c<T>(arg);
+            }
+        };
+
+        template <class T>
+        struct async_arg<T const &, enable_if_t<std::is_arithmetic<T>::value>> {
+            using type = T;
+            static type convert(T const *arg) { return *arg; }
+        };
+
+        template <class T>
+        struct async_arg<T &, enable_if_t<is_fortran_array_bindable<T &>::value && !is_c_array_ref<T &>::value>> {
+            using type = typename std::remove_const<T>::type;
+            static type convert(gen_fortran_array_descriptor *arg) { return convert_from_c<type>(arg); }
+        };
+
+        template <class T>
+        using async_arg_t = typename async_arg<T>::type;
+
+        /// Holds the impl together with the already converted arguments until a worker executes it.
+        template <class R, class Impl, class... Params>
+        struct async_call {
+            Impl m_fun;
+            std::tuple<async_arg_t<Params>...> m_args;
+
+            template <std::size_t... Is>
+            any_moveable invoke(index_sequence<Is...>) {
+                return invoke_async_impl_f<R>{}(m_fun, std::forward<Params>(std::get<Is>(m_args))...);
+            }
+
+            any_moveable operator()() { return invoke(make_index_sequence<sizeof...(Params)>{}); }
+        };
+
+        template <class R, class... Params, class Impl, class... Args>
+        async_call<R, Impl, Params...> make_async_call(Impl const &fun, Args... args) {
+            return {fun, std::tuple<async_arg_t<Params>...>(async_arg<Params>::convert(args)...)};
+        }
+
+        template <class T, class Impl>
+        struct async_f;
+
+        template <class R, class... Params, class Impl>
+        struct async_f<R(Params...), Impl> {
+            static_assert(std::is_void<R>::value || std::is_class<remove_reference_t<R>>::value,
+                "asynchronous bindings can only return void or class types, pass arithmetic results by reference");
+
+            Impl m_fun;
+
+            gen_handle *operator()(param_converted_to_c_t<Params>... args) const {
+                // the arguments are converted eagerly: descriptors and handles are only accessed on the calling thread
+                auto task =
+                    std::make_shared<std::packaged_task<any_moveable()>>(make_async_call<R, Params...>(m_fun, args...));
+                gen_handle *res = new gen_handle{task->get_future()};
+                async_execute([task] { (*task)(); });
+                return res;
+            }
+        };
+    } // namespace _impl
+
+    /// Transform a function type to the function type of its asynchronous flavour (returning a future)
+    template <class T>
+    using async_signature_t = typename _impl::async_signature<T>::type;
+
+    /// Wrap the functor of type `Impl` to a functor that can be invoked with the 'wrapped_t<async_signature_t<T>>'
+    /// signature and executes `Impl` on the worker pool.
+    template <class T, class Impl>
+    constexpr _impl::async_f<scratch_free_signature_t<T>, _impl::scratch_injected_t<T, decay_t<Impl>>>
+    wrap_async(Impl &&obj) {
+        return {_impl::inject_scratch<T>(std::forward<Impl>(obj))};
+    }
+
+    /// Specialization for function pointers.
+    template <class T>
+    constexpr _impl::async_f<scratch_free_signature_t<T>, _impl::scratch_injected_t<T, T *>> wrap_async(T *obj) {
+        return {_impl::inject_scratch<T>(obj)};
+    }
+} // namespace cpp_bindgen
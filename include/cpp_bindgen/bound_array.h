@@ -0,0 +1,39 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include "array_descriptor.h"
+#include "handle.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *  Binds an array once, to be passed (as the returned handle) to the parameters of type cpp_bindgen::bound_array<View>.
+ *
+ *  The C++ view of type `View` is created and validated when the handle is passed to such a parameter for the first
+ *  time and reused by the following calls. The descriptor is copied; the array itself has to stay valid while the
+ *  handle is used. The handle has to be released with gen_release(). The array must be contiguous, the Fortran
+ *  gen_bind_array() and gen_rebind_array() stop the program otherwise.
+ */
+gen_handle *gen_bind_array(gen_fortran_array_descriptor *descriptor);
+
+/**
+ *  Updates the array bound to `bound`, e.g. after it has been reallocated.
+ *
+ *  If the base pointer, the element type and the shape are the same as before, nothing happens (hence it is cheap to
+ *  call it once per time step); otherwise the views created so far are dropped and will be recreated from `descriptor`.
+ */
+void gen_rebind_array(gen_handle *bound, gen_fortran_array_descriptor *descriptor);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,92 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <type_traits>
+#include <vector>
+
+#include "common/any_moveable.hpp"
+#include "common/type_traits.hpp"
+
+#include "array_descriptor.h"
+#include "fortran_array_view.hpp"
+
+namespace cpp_bindgen {
+    namespace _impl {
+        template <class View>
+        struct bound_view {
+            View m_view;
+        };
+    } // namespace _impl
+
+    /// The object held by the handles returned by gen_bind_array(): the descriptor and the views created from it.
+    class bound_array_storage {
+        gen_fortran_array_descriptor m_descriptor;
+        std::vector<any_moveable> m_views;
+
+      public:
+        explicit bound_array_storage(gen_fortran_array_descriptor const &descriptor) : m_descriptor(descriptor) {}
+
+        /// True if `descriptor` describes the bound array: same base pointer, element type and shape.
+        bool matches(gen_fortran_array_descriptor const &descriptor) const {
+            if (descriptor.data != m_descriptor.data || descriptor.type != m_descriptor.type ||
+                descriptor.rank != m_descriptor.rank)
+                return false;
+            for (int i = 0; i < descriptor.rank; ++i)
+                if (descriptor.dims[i] != m_descriptor.dims[i])
+                    return false;
+            return true;
+        }
+
+        void rebind(gen_fortran_array_descriptor const &descriptor) {
+            if (matches(descriptor))
+                return;
+            m_descriptor = descriptor;
+            m_views.clear();
+        }
+
+        /// Returns the view of type `View`, it is created (and validated) by make_fortran_array_view() on first use.
+        template <class View>
+        remove_reference_t<View> &view() {
+            for (auto &&item : m_views)
+                if (auto *res = any_cast<_impl::bound_view<View>>(&item))
+                    return res->m_view;
+            m_views.emplace_back(_impl::bound_view<View>{make_fortran_array_view<View>(&m_descriptor)});
+            return any_cast<_impl::bound_view<View> &>(m_views.back()).m_view;
+        }
+    };
+
+    /**
+     *   A parameter type that accepts the handles returned by gen_bind_array() instead of arrays.
+     *
+     *   `View` is any type that can be used as a parameter bound to a Fortran array (e.g. a reference to a C array).
+     *   The view is created once per bound array and reused by all calls, which saves the descriptor setup in the Fortran
+     *   wrapper and the validation in make_fortran_array_view() on every call.
+     */
+    template <class View>
+    class bound_array {
+        static_assert(is_fortran_array_bindable<View>::value, "bound_array requires a type bindable to Fortran arrays");
+
+        using view_t = remove_reference_t<View>;
+        view_t *m_view;
+
+      public:
+        explicit bound_array(bound_array_storage &storage) : m_view(&storage.view<View>()) {}
+
+        view_t &get() const { return *m_view; }
+        operator view_t &() const { return *m_view; }
+    };
+
+    template <class T>
+    struct is_bound_array : std::false_type {};
+
+    template <class View>
+    struct is_bound_array<bound_array<View>> : std::true_type {};
+} // namespace cpp_bindgen
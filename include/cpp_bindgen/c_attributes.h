@@ -0,0 +1,52 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+/*
+ *  The qualifiers and attributes used in the generated C headers. They expand to nothing for compilers that do not
+ *  support them; each of them can be defined before the header is included to override the detection.
+ */
+
+#if defined(__has_attribute)
+#define GEN_HAS_ATTRIBUTE(attribute) __has_attribute(attribute)
+#elif defined(__GNUC__)
+#define GEN_HAS_ATTRIBUTE(attribute) 1
+#else
+#define GEN_HAS_ATTRIBUTE(attribute) 0
+#endif
+
+/* The pointers to arithmetic types of the bindings of libraries generated with the RESTRICT option do not alias. */
+#ifndef GEN_RESTRICT
+#if defined(__cplusplus) && (defined(__GNUC__) || defined(_MSC_VER))
+#define GEN_RESTRICT __restrict
+#elif !defined(__cplusplus) && defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901L
+#define GEN_RESTRICT restrict
+#else
+#define GEN_RESTRICT
+#endif
+#endif
+
+/* The pointer parameters at the given (one based) positions must not be null. */
+#ifndef GEN_NONNULL
+#if GEN_HAS_ATTRIBUTE(nonnull)
+#define GEN_NONNULL(...) __attribute__((nonnull(__VA_ARGS__)))
+#else
+#define GEN_NONNULL(...)
+#endif
+#endif
+
+/* The function does not throw C++ exceptions. */
+#ifndef GEN_NOTHROW
+#if GEN_HAS_ATTRIBUTE(nothrow)
+#define GEN_NOTHROW __attribute__((nothrow))
+#else
+#define GEN_NOTHROW
+#endif
+#endif
@@ -49,5 +49,22 @@ namespace cpp_bindgen {
         template <class F, typename std::enable_if<std::is_function<F>::value, int>::type = 0>
         struct arity : _impl::arity_helper<typename std::remove_cv<F>::type> {};
 
+        /// Since C++17 the exception specification is part of the function type, `R(Args...) noexcept` is mapped to
+        /// `R(Args...)`; other types remain the same.
+        template <class F>
+        struct remove_noexcept {
+            using type = F;
+        };
+
+#ifdef __cpp_noexcept_function_type
+        template <class Ret, class... Args>
+        struct remove_noexcept<Ret(Args...) noexcept> {
+            using type = Ret(Args...);
+        };
+#endif
+
+        template <class F>
+        using remove_noexcept_t = typename remove_noexcept<F>::type;
+
     } // namespace function_traits
 } // namespace cpp_bindgen
@@ -0,0 +1,105 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+// The few preprocessor utilities needed by each binding. They replace the ones of Boost.Preprocessor, whose headers
+// are costly to parse and whose repetition macros expand through many layers in every translation unit.
+
+#define GEN_PP_CAT(a, b) GEN_PP_CAT_IMPL(a, b)
+#define GEN_PP_CAT_IMPL(a, b) a##b
+
+/// `x` without its enclosing parentheses if it has any, e.g. to pass template-ids with commas as macro arguments.
+#define GEN_PP_REMOVE_PARENS(x) GEN_PP_REMOVE_PARENS_IMPL(GEN_PP_REMOVE_PARENS_STRIP x)
+#define GEN_PP_REMOVE_PARENS_STRIP(...) GEN_PP_REMOVE_PARENS_STRIP __VA_ARGS__
+#define GEN_PP_REMOVE_PARENS_IMPL(...) GEN_PP_REMOVE_PARENS_IMPL_IMPL(__VA_ARGS__)
+#define GEN_PP_REMOVE_PARENS_IMPL_IMPL(...) GEN_PP_REMOVE_PARENS_DONE_##__VA_ARGS__
+#define GEN_PP_REMOVE_PARENS_DONE_GEN_PP_REMOVE_PARENS_STRIP
+
+/// The largest count accepted by GEN_PP_ENUM and GEN_PP_ENUM_TRAILING.
+#define GEN_PP_LIMIT_ENUM 32
+
+/// `m(0, data), m(1, data), ..., m(n - 1, data)`
+#define GEN_PP_ENUM(n, m, data) GEN_PP_CAT(GEN_PP_ENUM_, n)(m, data)
+/// `, m(0, data), m(1, data), ..., m(n - 1, data)`
+#define GEN_PP_ENUM_TRAILING(n, m, data) GEN_PP_CAT(GEN_PP_ENUM_TRAILING_, n)(m, data)
+
+/// `param0, param1, ..., param(n - 1)`
+#define GEN_PP_ENUM_PARAMS(n, param) GEN_PP_ENUM(n, GEN_PP_ENUM_PARAMS_IMPL, param)
+/// `, param0, param1, ..., param(n - 1)`
+#define GEN_PP_ENUM_TRAILING_PARAMS(n, param) GEN_PP_ENUM_TRAILING(n, GEN_PP_ENUM_PARAMS_IMPL, param)
+#define GEN_PP_ENUM_PARAMS_IMPL(i, param) param##i
+
+#define GEN_PP_ENUM_0(m, d)
+#define GEN_PP_ENUM_1(m, d) m(0, d)
+#define GEN_PP_ENUM_2(m, d) GEN_PP_ENUM_1(m, d), m(1, d)
+#define GEN_PP_ENUM_3(m, d) GEN_PP_ENUM_2(m, d), m(2, d)
+#define GEN_PP_ENUM_4(m, d) GEN_PP_ENUM_3(m, d), m(3, d)
+#define GEN_PP_ENUM_5(m, d) GEN_PP_ENUM_4(m, d), m(4, d)
+#define GEN_PP_ENUM_6(m, d) GEN_PP_ENUM_5(m, d), m(5, d)
+#define GEN_PP_ENUM_7(m, d) GEN_PP_ENUM_6(m, d), m(6, d)
+#define GEN_PP_ENUM_8(m, d) GEN_PP_ENUM_7(m, d), m(7, d)
+#define GEN_PP_ENUM_9(m, d) GEN_PP_ENUM_8(m, d), m(8, d)
+#define GEN_PP_ENUM_10(m, d) GEN_PP_ENUM_9(m, d), m(9, d)
+#define GEN_PP_ENUM_11(m, d) GEN_PP_ENUM_10(m, d), m(10, d)
+#define GEN_PP_ENUM_12(m, d) GEN_PP_ENUM_11(m, d), m(11, d)
+#define GEN_PP_ENUM_13(m, d) GEN_PP_ENUM_12(m, d), m(12, d)
+#define GEN_PP_ENUM_14(m, d) GEN_PP_ENUM_13(m, d), m(13, d)
+#define GEN_PP_ENUM_15(m, d) GEN_PP_ENUM_14(m, d), m(14, d)
+#define GEN_PP_ENUM_16(m, d) GEN_PP_ENUM_15(m, d), m(15, d)
+#define GEN_PP_ENUM_17(m, d) GEN_PP_ENUM_16(m, d), m(16, d)
+#define GEN_PP_ENUM_18(m, d) GEN_PP_ENUM_17(m, d), m(17, d)
+#define GEN_PP_ENUM_19(m, d) GEN_PP_ENUM_18(m, d), m(18, d)
+#define GEN_PP_ENUM_20(m, d) GEN_PP_ENUM_19(m, d), m(19, d)
+#define GEN_PP_ENUM_21(m, d) GEN_PP_ENUM_20(m, d), m(20, d)
+#define GEN_PP_ENUM_22(m, d) GEN_PP_ENUM_21(m, d), m(21, d)
+#define GEN_PP_ENUM_23(m, d) GEN_PP_ENUM_22(m, d), m(22, d)
+#define GEN_PP_ENUM_24(m, d) GEN_PP_ENUM_23(m, d), m(23, d)
+#define GEN_PP_ENUM_25(m, d) GEN_PP_ENUM_24(m, d), m(24, d)
+#define GEN_PP_ENUM_26(m, d) GEN_PP_ENUM_25(m, d), m(25, d)
+#define GEN_PP_ENUM_27(m, d) GEN_PP_ENUM_26(m, d), m(26, d)
+#define GEN_PP_ENUM_28(m, d) GEN_PP_ENUM_27(m, d), m(27, d)
+#define GEN_PP_ENUM_29(m, d) GEN_PP_ENUM_28(m, d), m(28, d)
+#define GEN_PP_ENUM_30(m, d) GEN_PP_ENUM_29(m, d), m(29, d)
+#define GEN_PP_ENUM_31(m, d) GEN_PP_ENUM_30(m, d), m(30, d)
+#define GEN_PP_ENUM_32(m, d) GEN_PP_ENUM_31(m, d), m(31, d)
+
+#define GEN_PP_ENUM_TRAILING_0(m, d)
+#define GEN_PP_ENUM_TRAILING_1(m, d) GEN_PP_ENUM_TRAILING_0(m, d), m(0, d)
+#define GEN_PP_ENUM_TRAILING_2(m, d) GEN_PP_ENUM_TRAILING_1(m, d), m(1, d)
+#define GEN_PP_ENUM_TRAILING_3(m, d) GEN_PP_ENUM_TRAILING_2(m, d), m(2, d)
+#define GEN_PP_ENUM_TRAILING_4(m, d) GEN_PP_ENUM_TRAILING_3(m, d), m(3, d)
+#define GEN_PP_ENUM_TRAILING_5(m, d) GEN_PP_ENUM_TRAILING_4(m, d), m(4, d)
+#define GEN_PP_ENUM_TRAILING_6(m, d) GEN_PP_ENUM_TRAILING_5(m, d), m(5, d)
+#define GEN_PP_ENUM_TRAILING_7(m, d) GEN_PP_ENUM_TRAILING_6(m, d), m(6, d)
+#define GEN_PP_ENUM_TRAILING_8(m, d) GEN_PP_ENUM_TRAILING_7(m, d), m(7, d)
+#define GEN_PP_ENUM_TRAILING_9(m, d) GEN_PP_ENUM_TRAILING_8(m, d), m(8, d)
+#define GEN_PP_ENUM_TRAILING_10(m, d) GEN_PP_ENUM_TRAILING_9(m, d), m(9, d)
+#define GEN_PP_ENUM_TRAILING_11(m, d) GEN_PP_ENUM_TRAILING_10(m, d), m(10, d)
+#define GEN_PP_ENUM_TRAILING_12(m, d) GEN_PP_ENUM_TRAILING_11(m, d), m(11, d)
+#define GEN_PP_ENUM_TRAILING_13(m, d) GEN_PP_ENUM_TRAILING_12(m, d), m(12, d)
+#define GEN_PP_ENUM_TRAILING_14(m, d) GEN_PP_ENUM_TRAILING_13(m, d), m(13, d)
+#define GEN_PP_ENUM_TRAILING_15(m, d) GEN_PP_ENUM_TRAILING_14(m, d), m(14, d)
+#define GEN_PP_ENUM_TRAILING_16(m, d) GEN_PP_ENUM_TRAILING_15(m, d), m(15, d)
+#define GEN_PP_ENUM_TRAILING_17(m, d) GEN_PP_ENUM_TRAILING_16(m, d), m(16, d)
+#define GEN_PP_ENUM_TRAILING_18(m, d) GEN_PP_ENUM_TRAILING_17(m, d), m(17, d)
+#define GEN_PP_ENUM_TRAILING_19(m, d) GEN_PP_ENUM_TRAILING_18(m, d), m(18, d)
+#define GEN_PP_ENUM_TRAILING_20(m, d) GEN_PP_ENUM_TRAILING_19(m, d), m(19, d)
+#define GEN_PP_ENUM_TRAILING_21(m, d) GEN_PP_ENUM_TRAILING_20(m, d), m(20, d)
+#define GEN_PP_ENUM_TRAILING_22(m, d) GEN_PP_ENUM_TRAILING_21(m, d), m(21, d)
+#define GEN_PP_ENUM_TRAILING_23(m, d) GEN_PP_ENUM_TRAILING_22(m, d), m(22, d)
+#define GEN_PP_ENUM_TRAILING_24(m, d) GEN_PP_ENUM_TRAILING_23(m, d), m(23, d)
+#define GEN_PP_ENUM_TRAILING_25(m, d) GEN_PP_ENUM_TRAILING_24(m, d), m(24, d)
+#define GEN_PP_ENUM_TRAILING_26(m, d) GEN_PP_ENUM_TRAILING_25(m, d), m(25, d)
+#define GEN_PP_ENUM_TRAILING_27(m, d) GEN_PP_ENUM_TRAILING_26(m, d), m(26, d)
+#define GEN_PP_ENUM_TRAILING_28(m, d) GEN_PP_ENUM_TRAILING_27(m, d), m(27, d)
+#define GEN_PP_ENUM_TRAILING_29(m, d) GEN_PP_ENUM_TRAILING_28(m, d), m(28, d)
+#define GEN_PP_ENUM_TRAILING_30(m, d) GEN_PP_ENUM_TRAILING_29(m, d), m(29, d)
+#define GEN_PP_ENUM_TRAILING_31(m, d) GEN_PP_ENUM_TRAILING_30(m, d), m(30, d)
+#define GEN_PP_ENUM_TRAILING_32(m, d) GEN_PP_ENUM_TRAILING_31(m, d), m(31, d)
@@ -35,4 +35,11 @@ namespace cpp_bindgen {
     using decay_t = typename std::decay<T>::type;
     template <bool V, class T = void>
     using enable_if_t = typename std::enable_if<V, T>::type;
+
+    template <class...>
+    struct make_void {
+        using type = void;
+    };
+    template <class... Ts>
+    using void_t = typename make_void<Ts...>::type;
 } // namespace cpp_bindgen
@@ -0,0 +1,41 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// The type of the symbols returned by gen_dispatch_symbol(), they are cast to the type of the function.
+typedef void (*gen_dispatch_function)(void);
+
+/**
+ *  Loads the shared library at `path` and binds all its symbols (RTLD_NOW | RTLD_LOCAL), returns NULL if it can not be
+ *  loaded, see gen_dispatch_error().
+ *
+ *  The loaders generated with the DISPATCH option of cpp_bindgen_add_library() (<library-name>_load() in C and
+ *  <module-name>_load() in Fortran) fill a table of function pointers with the bindings of the library, the programs
+ *  calling them do not link the library. The runtime of the bindings is resolved from the program, which links the
+ *  whole runtime and exports it (see the <library-name>_dispatch_c and _dispatch_fortran targets).
+ */
+void *gen_dispatch_open(char const *path);
+
+/// The function `name` of a library returned by gen_dispatch_open(), NULL if there is none.
+gen_dispatch_function gen_dispatch_symbol(void *library, char const *name);
+
+/// Unloads a library returned by gen_dispatch_open(), the functions obtained from it must not be called anymore.
+void gen_dispatch_close(void *library);
+
+/// The description of the last error of gen_dispatch_open() or gen_dispatch_symbol() on the calling thread, or NULL.
+char const *gen_dispatch_error(void);
+
+#ifdef __cplusplus
+}
+#endif
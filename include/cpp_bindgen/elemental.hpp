@@ -0,0 +1,122 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "common/conjunction.hpp"
+#include "common/type_traits.hpp"
+
+#include "array_descriptor.h"
+#include "fortran_array_view.hpp"
+
+// the loops of elemental bindings are vectorized with OpenMP SIMD if it is enabled, see cpp_bindgen_add_library()
+#if defined(_OPENMP) || defined(CPP_BINDGEN_OPENMP_SIMD)
+#define GEN_ELEMENTAL_SIMD _Pragma("omp simd")
+#else
+#define GEN_ELEMENTAL_SIMD
+#endif
+
+namespace cpp_bindgen {
+    namespace _impl {
+        template <class T>
+        struct is_elemental_param
+            : bool_constant<std::is_arithmetic<decay_t<T>>::value &&
+                            (!std::is_reference<T>::value ||
+                                std::is_const<remove_reference_t<T>>::value)> {};
+
+        template <class>
+        struct elemental_param_converted_to_c {
+            using type = gen_fortran_array_descriptor *;
+        };
+
+        template <class T>
+        struct elemental;
+
+        /// The C signature of the array variant: the result array is passed as the first descriptor.
+        template <class R, class... Params>
+        struct elemental<R(Params...)> {
+            using type = void(gen_fortran_array_descriptor *,
+                typename elemental_param_converted_to_c<Params>::type...);
+        };
+
+        inline void check_elemental_descriptor(gen_fortran_array_descriptor const &descriptor,
+            gen_fortran_array_kind kind,
+            gen_fortran_array_descriptor const &result) {
+            if (descriptor.type != kind)
+                throw std::runtime_error("Types do not match: fortran-type (" + std::to_string(descriptor.type) +
+                                         ") != c-type (" + std::to_string(kind) + ")");
+            if (descriptor.rank != result.rank)
+                throw std::runtime_error("Rank does not match: argument-rank (" + std::to_string(descriptor.rank) +
+                                         ") != result-rank (" + std::to_string(result.rank) + ")");
+            for (int i = 0; i < descriptor.rank; ++i)
+                if (descriptor.dims[i] != result.dims[i])
+                    throw std::runtime_error("Extents do not match");
+        }
+
+        inline std::size_t elemental_size(gen_fortran_array_descriptor const &descriptor) {
+            std::size_t size = 1;
+            for (int i = 0; i < descriptor.rank; ++i)
+                size *= descriptor.dims[i];
+            return size;
+        }
+
+        template <class R, class Impl, class... Ts>
+        void elemental_loop(Impl const &fun, std::size_t size, R *__restrict__ result, Ts const *__restrict__... args) {
+            GEN_ELEMENTAL_SIMD
+            for (std::size_t i = 0; i < size; ++i)
+                result[i] = fun(args[i]...);
+        }
+
+        template <class T, class Impl>
+        struct elemental_f;
+
+        template <class R, class... Params, class Impl>
+        struct elemental_f<R(Params...), Impl> {
+            static_assert(std::is_arithmetic<R>::value, "elemental bindings must return an arithmetic type");
+            static_assert(conjunction<is_elemental_param<Params>...>::value,
+                "elemental bindings can only take arithmetic parameters by value or by const reference");
+
+            Impl m_fun;
+
+            void operator()(gen_fortran_array_descriptor *result,
+                typename elemental_param_converted_to_c<Params>::type... args) const {
+                check_elemental_descriptor(*result, fortran_array_element_kind<R>::value, *result);
+                (void)(int[]){
+                    0, (check_elemental_descriptor(*args, fortran_array_element_kind<decay_t<Params>>::value, *result),
+                           0)...};
+                elemental_loop(m_fun,
+                    elemental_size(*result),
+                    static_cast<R *>(result->data),
+                    static_cast<decay_t<Params> const *>(args->data)...);
+            }
+        };
+    } // namespace _impl
+
+    /// Transform a scalar function type to the C function type of its elemental array variant.
+    template <class T>
+    using elemental_t = typename _impl::elemental<T>::type;
+
+    /// Wrap the scalar functor of type `Impl` to a functor that applies it element-wise to the arrays passed with the
+    /// `elemental_t<T>` signature.
+    template <class T, class Impl>
+    constexpr _impl::elemental_f<T, typename std::decay<Impl>::type> elemental(Impl &&obj) {
+        return {std::forward<Impl>(obj)};
+    }
+
+    /// Specialization for function pointers.
+    template <class T>
+    constexpr _impl::elemental_f<T, T *> elemental(T *obj) {
+        return {obj};
+    }
+} // namespace cpp_bindgen
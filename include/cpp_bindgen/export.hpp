@@ -9,21 +9,137 @@
  */
 #pragma once
 
-#include <boost/preprocessor.hpp>
+#include <boost/preprocessor/arithmetic/inc.hpp>
+#include <boost/preprocessor/repetition/repeat_from_to.hpp>
+#include <boost/preprocessor/seq/enum.hpp>
+#include <boost/preprocessor/seq/for_each_i.hpp>
+#include <boost/preprocessor/seq/for_each_product.hpp>
+#include <boost/preprocessor/seq/variadic_seq_to_seq.hpp>
 
 #include "common/function_traits.hpp"
+#include "common/preprocessor.hpp"
+#include "async.hpp"
+#include "elemental.hpp"
 #include "function_wrapper.hpp"
 #include "generator.hpp"
+#include "parallel.hpp"
+#include "profile.hpp"
+#include "queue.hpp"
+#include "trace.hpp"
+#include "visit.hpp"
 
-#define GEN_EXPORT_BINDING_IMPL_PARAM_DECL(z, i, signature) \
-    typename std::tuple_element<i,                          \
+// The QUEUE, PROFILE and TRUSTED options of cpp_bindgen_add_library() change how the generated functions invoke `impl`.
+// Without QUEUE and PROFILE, the signatures made only of arithmetic types call `impl` directly, see wrap_elided().
+#if defined(CPP_BINDGEN_ENABLE_QUEUE) && defined(CPP_BINDGEN_PROFILE)
+#error "the QUEUE and PROFILE options can not be combined"
+#elif defined(CPP_BINDGEN_PROFILE) && defined(CPP_BINDGEN_TRUSTED)
+#error "the PROFILE and TRUSTED options can not be combined"
+#elif defined(CPP_BINDGEN_ENABLE_QUEUE)
+#define GEN_EXPORT_BINDING_IMPL_CALL(name, cppsignature, impl, params) \
+    return ::cpp_bindgen::wrap_queued<cppsignature>(impl) params
+#define GEN_EXPORT_BINDING_IMPL_QUEUE_SYNC() ::cpp_bindgen::queue_sync()
+#elif defined(CPP_BINDGEN_PROFILE)
+#define GEN_EXPORT_BINDING_IMPL_CALL(name, cppsignature, impl, params)                      \
+    static thread_local ::cpp_bindgen::profile_thread_counters gen_profile_counters(#name); \
+    return ::cpp_bindgen::wrap_profiled<cppsignature>(gen_profile_counters.get(), impl) params
+#define GEN_EXPORT_BINDING_IMPL_QUEUE_SYNC() (void)0
+#elif defined(CPP_BINDGEN_TRUSTED)
+#define GEN_EXPORT_BINDING_IMPL_CALL(name, cppsignature, impl, params) \
+    return ::cpp_bindgen::wrap_elided<cppsignature, true>(impl) params
+#define GEN_EXPORT_BINDING_IMPL_QUEUE_SYNC() (void)0
+#else
+#define GEN_EXPORT_BINDING_IMPL_CALL(name, cppsignature, impl, params) \
+    return ::cpp_bindgen::wrap_elided<cppsignature>(impl) params
+#define GEN_EXPORT_BINDING_IMPL_QUEUE_SYNC() (void)0
+#endif
+
+// With the TRACE option each call of a generated function is a range on the timeline, see gen_trace_begin().
+#ifdef CPP_BINDGEN_TRACE
+#define GEN_EXPORT_BINDING_IMPL_TRACE(name) ::cpp_bindgen::trace_scope gen_trace_scope(#name)
+#else
+#define GEN_EXPORT_BINDING_IMPL_TRACE(name) (void)0
+#endif
+
+// With the RESTRICT option the pointers to arithmetic types are restrict-qualified in the generated C header.
+#ifdef CPP_BINDGEN_RESTRICT
+#define GEN_EXPORT_BINDING_IMPL_RESTRICT true
+#else
+#define GEN_EXPORT_BINDING_IMPL_RESTRICT false
+#endif
+
+// The generated functions stay exported from the shared libraries built with the SHARED option of
+// cpp_bindgen_add_library(), where the other symbols are hidden. The functions defined by hand next to
+// GEN_ADD_GENERATED_DECLARATION() should be marked with it as well.
+#ifdef __GNUC__
+#define GEN_EXPORT_VISIBILITY __attribute__((visibility("default")))
+#else
+#define GEN_EXPORT_VISIBILITY
+#endif
+
+// The functions generated with the QUEUE, PROFILE and TRACE options allocate, they are never declared nothrow.
+#if defined(CPP_BINDGEN_ENABLE_QUEUE) || defined(CPP_BINDGEN_PROFILE) || defined(CPP_BINDGEN_TRACE)
+#define GEN_EXPORT_BINDING_IMPL_NOTHROW(cppsignature, impl) false
+#else
+#define GEN_EXPORT_BINDING_IMPL_NOTHROW(cppsignature, impl) ::cpp_bindgen::_impl::is_nothrow_wrap<cppsignature>(impl)
+#endif
+
+// The signature of the function `impl` (in C++17 `noexcept` is part of it, but the wrappers do not expect it).
+#define GEN_EXPORT_BINDING_IMPL_SIGNATURE(impl) \
+    ::cpp_bindgen::function_traits::remove_noexcept_t<decltype(GEN_PP_REMOVE_PARENS(impl))>
+
+#define GEN_EXPORT_BINDING_IMPL_C_ATTRIBUTES(name, cppsignature, nothrow) \
+    GEN_ADD_RECORD_IMPL(c_attributes_record,                              \
+        gen_c_attributes,                                                 \
+        generated_c_attributes_record_##name,                             \
+        ::cpp_bindgen::_impl::c_attributes<cppsignature>(#name, GEN_EXPORT_BINDING_IMPL_RESTRICT, nothrow))
+
+#define GEN_EXPORT_BINDING_IMPL_PARAM_DECL(i, signature) \
+    typename std::tuple_element<i,                       \
         ::cpp_bindgen::function_traits::parameter_types<::cpp_bindgen::wrapped_t<signature>>::type>::type param_##i
 
-#define GEN_ADD_GENERATED_DEFINITION_IMPL(n, name, cppsignature, impl)                                            \
-    static_assert(::cpp_bindgen::function_traits::arity<cppsignature>::value == n, "arity mismatch");             \
-    extern "C" typename ::cpp_bindgen::function_traits::result_type<::cpp_bindgen::wrapped_t<cppsignature>>::type \
-    name(BOOST_PP_ENUM(n, GEN_EXPORT_BINDING_IMPL_PARAM_DECL, cppsignature)) {                                    \
-        return ::cpp_bindgen::wrap<cppsignature>(impl)(BOOST_PP_ENUM_PARAMS(n, param_));                          \
+// `n` is the arity of the generated function, the `scratch &` parameters of `cppsignature` are not counted.
+#define GEN_EXPORT_BINDING_IMPL_CHECK_ARITY(n, cppsignature)                                                      \
+    static_assert(                                                                                                \
+        ::cpp_bindgen::function_traits::arity<::cpp_bindgen::scratch_free_signature_t<cppsignature>>::value == n, \
+        "arity mismatch")
+
+#define GEN_ADD_GENERATED_DEFINITION_IMPL(n, name, cppsignature, impl)                                             \
+    GEN_EXPORT_BINDING_IMPL_CHECK_ARITY(n, cppsignature);                                                          \
+    GEN_EXPORT_BINDING_IMPL_C_ATTRIBUTES(name, cppsignature, GEN_EXPORT_BINDING_IMPL_NOTHROW(cppsignature, impl)); \
+    extern "C" GEN_EXPORT_VISIBILITY                                                                               \
+        typename ::cpp_bindgen::function_traits::result_type<::cpp_bindgen::wrapped_t<cppsignature>>::type         \
+        name(GEN_PP_ENUM(n, GEN_EXPORT_BINDING_IMPL_PARAM_DECL, cppsignature)) {                                   \
+        GEN_EXPORT_BINDING_IMPL_TRACE(name);                                                                       \
+        GEN_EXPORT_BINDING_IMPL_CALL(name, cppsignature, impl, (GEN_PP_ENUM_PARAMS(n, param_)));                   \
+    }
+
+#define GEN_ADD_GENERATED_ASYNC_DEFINITION_IMPL(n, name, cppsignature, impl)                 \
+    GEN_EXPORT_BINDING_IMPL_CHECK_ARITY(n, cppsignature);                                    \
+    GEN_EXPORT_BINDING_IMPL_C_ATTRIBUTES(name, cppsignature, false);                         \
+    extern "C" GEN_EXPORT_VISIBILITY gen_handle *name(                                       \
+        GEN_PP_ENUM(n, GEN_EXPORT_BINDING_IMPL_PARAM_DECL, cppsignature)) {                  \
+        GEN_EXPORT_BINDING_IMPL_TRACE(name);                                                 \
+        GEN_EXPORT_BINDING_IMPL_QUEUE_SYNC();                                                \
+        return ::cpp_bindgen::wrap_async<cppsignature>(impl)(GEN_PP_ENUM_PARAMS(n, param_)); \
+    }
+
+#define GEN_ADD_GENERATED_PARALLEL_DEFINITION_IMPL(n, name, cppsignature, impl)                                    \
+    GEN_EXPORT_BINDING_IMPL_CHECK_ARITY(n, cppsignature);                                                          \
+    GEN_EXPORT_BINDING_IMPL_C_ATTRIBUTES(name, cppsignature, false);                                               \
+    extern "C" GEN_EXPORT_VISIBILITY void name(GEN_PP_ENUM(n, GEN_EXPORT_BINDING_IMPL_PARAM_DECL, cppsignature)) { \
+        GEN_EXPORT_BINDING_IMPL_TRACE(name);                                                                       \
+        GEN_EXPORT_BINDING_IMPL_QUEUE_SYNC();                                                                      \
+        ::cpp_bindgen::wrap_parallel<cppsignature>(impl)(GEN_PP_ENUM_PARAMS(n, param_));                           \
+    }
+
+// All the parameters of the array variant are descriptors, the one of the result comes first, see elemental_t.
+#define GEN_ADD_GENERATED_ELEMENTAL_DEFINITION_IMPL(n, name, cppsignature, impl)                           \
+    static_assert(::cpp_bindgen::function_traits::arity<cppsignature>::value == n, "arity mismatch");      \
+    extern "C" GEN_EXPORT_VISIBILITY void name(gen_fortran_array_descriptor *param_result                  \
+            GEN_PP_ENUM_TRAILING_PARAMS(n, gen_fortran_array_descriptor *param_)) {                        \
+        GEN_EXPORT_BINDING_IMPL_TRACE(name);                                                               \
+        GEN_EXPORT_BINDING_IMPL_QUEUE_SYNC();                                                              \
+        ::cpp_bindgen::elemental<cppsignature>(impl)(param_result GEN_PP_ENUM_TRAILING_PARAMS(n, param_)); \
     }
 
 /**
@@ -42,6 +158,7 @@
  *       - types that fulfill the concept of being fortran_array_bindable are transformed to a
  *         gen_fortran_array_descriptor
  *       - classes (and structures) and references or pointers to them are transformed to `gen_handle*`;
+ *       - `cpp_bindgen::scratch &` parameters are dropped, `impl` gets the scratch arena of the calling thread;
  *       - all other parameter types will cause a compiler error.
  *   Additionally the newly generated function will be registered for automatic interface generation.
  *
@@ -74,6 +191,7 @@
  *       - types that are fortran_array_wrappable are transformed to a gen_fortran_array_descriptor in the c-bindings,
  *         and provide a wrapper in the fortran-bindings such that they can be called with a fortran array
  *       - classes (and structures) and references or pointers to them are transformed to `gen_handle*`;
+ *       - `cpp_bindgen::scratch &` parameters are dropped, `impl` gets the scratch arena of the calling thread;
  *       - all other parameter types will cause a compiler error.
  *   Additionally the newly generated function will be registered for automatic interface generation.
  *
@@ -88,23 +206,131 @@
 
 /// The flavour of GEN_EXPORT_BINDING_WITH_SIGNATURE where the `impl` parameter is a function pointer.
 #define GEN_EXPORT_BINDING(n, name, impl) \
-    GEN_EXPORT_BINDING_WITH_SIGNATURE(n, name, decltype(BOOST_PP_REMOVE_PARENS(impl)), impl)
+    GEN_EXPORT_BINDING_WITH_SIGNATURE(n, name, GEN_EXPORT_BINDING_IMPL_SIGNATURE(impl), impl)
 #define GEN_EXPORT_BINDING_WRAPPED(n, name, impl) \
-    GEN_EXPORT_BINDING_WITH_SIGNATURE_WRAPPED(n, name, decltype(BOOST_PP_REMOVE_PARENS(impl)), impl)
+    GEN_EXPORT_BINDING_WITH_SIGNATURE_WRAPPED(n, name, GEN_EXPORT_BINDING_IMPL_SIGNATURE(impl), impl)
+
+/**
+ *   Defines the function with the given name with the C linkage that executes `impl` asynchronously.
+ *
+ *   The arguments are converted as described for GEN_EXPORT_BINDING_WITH_SIGNATURE when the function is called, then
+ *   `impl` is queued for execution on the worker pool (see gen_set_async_num_threads()) and a future handle
+ *   (`gen_handle*`) is returned immediately. `gen_wait(future)` blocks until `impl` has finished and returns a handle to
+ *   the result (or a null pointer for `void`), rethrowing the exception if `impl` failed; `gen_test(future)` checks for
+ *   completion without blocking. Both the future handle and the result handle have to be released with `gen_release`.
+ *
+ *   The result type of `cppsignature` has to be `void` or a class type. Arrays, non-const arithmetic references and
+ *   pointers, and the objects behind handles that are passed as arguments are accessed during the execution of `impl`,
+ *   hence they must stay valid until `gen_wait` has returned. The generated declarations carry a note saying so. The
+ *   values of const arithmetic references and the array views other than C arrays are copied when the function is
+ *   called. The arrays are always validated, the TRUSTED option of cpp_bindgen_add_library() does not apply. The
+ *   Fortran wrappers take the arrays without copying them: a non-contiguous array stops the program.
+ *
+ *   @param n The arity of the generated function.
+ *   @param name The name of the generated function.
+ *   @param cppsignature The signature that will be used to invoke `impl`.
+ *   @param impl The functor that the generated function will delegate to.
+ */
+#define GEN_EXPORT_ASYNC_BINDING_WITH_SIGNATURE(n, name, cppsignature, impl) \
+    GEN_ADD_GENERATED_ASYNC_DEFINITION_IMPL(n, name, cppsignature, impl)     \
+    GEN_ADD_GENERATED_ASYNC_DECLARATION(                                     \
+        ::cpp_bindgen::wrapped_t<::cpp_bindgen::async_signature_t<cppsignature>>, name)
+
+/// The flavour of GEN_EXPORT_ASYNC_BINDING_WITH_SIGNATURE with an additional wrapper in the Fortran bindings, see
+/// GEN_EXPORT_BINDING_WITH_SIGNATURE_WRAPPED.
+#define GEN_EXPORT_ASYNC_BINDING_WITH_SIGNATURE_WRAPPED(n, name, cppsignature, impl) \
+    GEN_ADD_GENERATED_ASYNC_DEFINITION_IMPL(n, name, cppsignature, impl)             \
+    GEN_ADD_GENERATED_ASYNC_DECLARATION_WRAPPED(::cpp_bindgen::async_signature_t<cppsignature>, name)
+
+/// The flavour of GEN_EXPORT_ASYNC_BINDING_WITH_SIGNATURE where the `impl` parameter is a function pointer.
+#define GEN_EXPORT_ASYNC_BINDING(n, name, impl) \
+    GEN_EXPORT_ASYNC_BINDING_WITH_SIGNATURE(n, name, GEN_EXPORT_BINDING_IMPL_SIGNATURE(impl), impl)
+#define GEN_EXPORT_ASYNC_BINDING_WRAPPED(n, name, impl) \
+    GEN_EXPORT_ASYNC_BINDING_WITH_SIGNATURE_WRAPPED(n, name, GEN_EXPORT_BINDING_IMPL_SIGNATURE(impl), impl)
+
+/**
+ *   Defines the function with the given name with the C linkage that executes `impl` in parallel on tiles of its array
+ *   arguments.
+ *
+ *   The generated function has the same signature as with GEN_EXPORT_BINDING_WITH_SIGNATURE. `impl` is written for a
+ *   block of the arrays: the (contiguous) arrays passed as gen_fortran_array_descriptor are split along their outermost
+ *   dimension, i.e. the last Fortran dimension, into tiles of gen_set_parallel_grain_size() slices, and `impl` is
+ *   called for every tile, with the arrays restricted to the tile and all other arguments unchanged. The tiles are
+ *   executed concurrently with OpenMP (if the bindings runtime is built with it) or on a fixed team of threads (see
+ *   gen_set_parallel_num_threads()), in both cases with a static schedule: in every call each thread processes the
+ *   same contiguous range of tiles, which keeps the data where it was first touched.
+ *
+ *   The result type of `cppsignature` has to be `void`, all arrays must have the same outermost extent and `impl` must
+ *   be safe to call concurrently for disjoint tiles. Array types with static extents, like C arrays, do not match the
+ *   tiles; use types with dynamic extents, e.g. cpp_bindgen::descriptor_view.
+ *
+ *   @param n The arity of the generated function.
+ *   @param name The name of the generated function.
+ *   @param cppsignature The signature that will be used to invoke `impl`.
+ *   @param impl The functor that the generated function will delegate to.
+ */
+#define GEN_EXPORT_PARALLEL_BINDING_WITH_SIGNATURE(n, name, cppsignature, impl) \
+    GEN_ADD_GENERATED_PARALLEL_DEFINITION_IMPL(n, name, cppsignature, impl)     \
+    GEN_ADD_GENERATED_DECLARATION(::cpp_bindgen::wrapped_t<cppsignature>, name)
+
+/// The flavour of GEN_EXPORT_PARALLEL_BINDING_WITH_SIGNATURE with an additional wrapper in the Fortran bindings, see
+/// GEN_EXPORT_BINDING_WITH_SIGNATURE_WRAPPED.
+#define GEN_EXPORT_PARALLEL_BINDING_WITH_SIGNATURE_WRAPPED(n, name, cppsignature, impl) \
+    GEN_ADD_GENERATED_PARALLEL_DEFINITION_IMPL(n, name, cppsignature, impl)             \
+    GEN_ADD_GENERATED_DECLARATION_WRAPPED(cppsignature, name)
+
+/// The flavour of GEN_EXPORT_PARALLEL_BINDING_WITH_SIGNATURE where the `impl` parameter is a function pointer.
+#define GEN_EXPORT_PARALLEL_BINDING(n, name, impl) \
+    GEN_EXPORT_PARALLEL_BINDING_WITH_SIGNATURE(n, name, GEN_EXPORT_BINDING_IMPL_SIGNATURE(impl), impl)
+#define GEN_EXPORT_PARALLEL_BINDING_WRAPPED(n, name, impl) \
+    GEN_EXPORT_PARALLEL_BINDING_WITH_SIGNATURE_WRAPPED(n, name, GEN_EXPORT_BINDING_IMPL_SIGNATURE(impl), impl)
+
+/**
+ *   Defines a scalar function together with its elemental array variant, both with the C linkage, and makes them
+ *   available in Fortran under the generic name `name`.
+ *
+ *   The signature has to consist of an arithmetic result type and arithmetic parameters (passed by value or by const
+ *   reference). The following functions are generated:
+ *     - `name_scalar` with the C signature of `cppsignature`;
+ *     - `name_array` taking a gen_fortran_array_descriptor for the result followed by one gen_fortran_array_descriptor
+ *       per parameter. All arrays must be contiguous and have the same shape; `impl` is applied element-wise in a loop
+ *       annotated with `#pragma omp simd` (if OpenMP or OpenMP SIMD is enabled).
+ *   In the Fortran bindings, `name_scalar` and the Fortran wrappers `name_array1`, `name_array2` and `name_array3` of
+ *   `name_array` (for arrays of rank 1 to 3) are combined in the generic interface `name`. The wrappers return an array
+ *   of the shape of their first argument.
+ *
+ *   @param n The arity of the generated scalar function.
+ *   @param name The generic name of the generated functions.
+ *   @param cppsignature The signature that will be used to invoke `impl`.
+ *   @param impl The functor that the generated functions will delegate to.
+ */
+#define GEN_EXPORT_ELEMENTAL_BINDING_WITH_SIGNATURE(n, name, cppsignature, impl)     \
+    GEN_EXPORT_BINDING_WITH_SIGNATURE(n, name##_scalar, cppsignature, impl);         \
+    GEN_ADD_GENERIC_DECLARATION(name, name##_scalar);                                \
+    GEN_ADD_GENERATED_ELEMENTAL_DEFINITION_IMPL(n, name##_array, cppsignature, impl) \
+    GEN_ADD_GENERATED_ELEMENTAL_DECLARATION(cppsignature, name##_array);             \
+    GEN_ADD_GENERIC_DECLARATION(name, name##_array1);                                \
+    GEN_ADD_GENERIC_DECLARATION(name, name##_array2);                                \
+    GEN_ADD_GENERIC_DECLARATION(name, name##_array3)
+
+/// The flavour of GEN_EXPORT_ELEMENTAL_BINDING_WITH_SIGNATURE where the `impl` parameter is a function pointer.
+#define GEN_EXPORT_ELEMENTAL_BINDING(n, name, impl) \
+    GEN_EXPORT_ELEMENTAL_BINDING_WITH_SIGNATURE(n, name, GEN_EXPORT_BINDING_IMPL_SIGNATURE(impl), impl)
 
 #define GEN_EXPORT_GENERIC_BINDING_IMPL_IMPL(generatorsuffix, n, generic_name, concrete_name, impl) \
-    BOOST_PP_CAT(GEN_EXPORT_BINDING, generatorsuffix)(n, concrete_name, impl);                      \
+    GEN_PP_CAT(GEN_EXPORT_BINDING, generatorsuffix)(n, concrete_name, impl);                        \
     GEN_ADD_GENERIC_DECLARATION(generic_name, concrete_name)
 
 #define GEN_EXPORT_GENERIC_BINDING_IMPL(generatorsuffix, n, name, suffix, impl) \
-    GEN_EXPORT_GENERIC_BINDING_IMPL_IMPL(generatorsuffix, n, name, BOOST_PP_CAT(name, suffix), impl)
+    GEN_EXPORT_GENERIC_BINDING_IMPL_IMPL(generatorsuffix, n, name, GEN_PP_CAT(name, suffix), impl)
 
-#define GEN_EXPORT_GENERIC_BINDING_IMPL_FUNCTOR(r, data, i, elem)    \
-    GEN_EXPORT_GENERIC_BINDING_IMPL(BOOST_PP_TUPLE_ELEM(4, 0, data), \
-        BOOST_PP_TUPLE_ELEM(4, 1, data),                             \
-        BOOST_PP_TUPLE_ELEM(4, 2, data),                             \
-        i,                                                           \
-        (BOOST_PP_TUPLE_ELEM(4, 3, data) < BOOST_PP_REMOVE_PARENS(elem) >));
+// `data` is `(generatorsuffix, n, name, impl_template)`
+#define GEN_EXPORT_GENERIC_BINDING_IMPL_FUNCTOR(r, data, i, elem) \
+    GEN_EXPORT_GENERIC_BINDING_IMPL_FUNCTOR_IMPL(i, elem, GEN_PP_REMOVE_PARENS(data))
+#define GEN_EXPORT_GENERIC_BINDING_IMPL_FUNCTOR_IMPL(i, elem, ...) \
+    GEN_EXPORT_GENERIC_BINDING_IMPL_FUNCTOR_IMPL_IMPL(i, elem, __VA_ARGS__)
+#define GEN_EXPORT_GENERIC_BINDING_IMPL_FUNCTOR_IMPL_IMPL(i, elem, generatorsuffix, n, name, impl_template) \
+    GEN_EXPORT_GENERIC_BINDING_IMPL(generatorsuffix, n, name, i, (impl_template < GEN_PP_REMOVE_PARENS(elem) >));
 
 #define GEN_EXPORT_GENERIC_BINDING(n, name, impl_template, template_params) \
     BOOST_PP_SEQ_FOR_EACH_I(GEN_EXPORT_GENERIC_BINDING_IMPL_FUNCTOR,        \
@@ -118,6 +344,42 @@
         BOOST_PP_VARIADIC_SEQ_TO_SEQ(template_params))                              \
     static_assert(1, "")
 
+#define GEN_EXPORT_GENERIC_BINDING_PRODUCT_IMPL_RANK(z, rank, data) (rank)
+#define GEN_EXPORT_GENERIC_BINDING_PRODUCT_IMPL_PARAMS(r, product) ((BOOST_PP_SEQ_ENUM(product)))
+
+/**
+ *   Defines the wrapped bindings of `impl_template<kind, rank>` for every kind in the sequence `kinds` and every rank
+ *   from `min_rank` to `max_rank` and combines them in the generic interface `name`, i.e.
+ *
+ *   @code
+ *   GEN_EXPORT_GENERIC_BINDING_PRODUCT_WRAPPED(2, fill, fill_impl, (float)(double), 1, 2);
+ *   @endcode
+ *
+ *   is equivalent to
+ *
+ *   @code
+ *   GEN_EXPORT_GENERIC_BINDING_WRAPPED(2, fill, fill_impl, (float, 1)(float, 2)(double, 1)(double, 2));
+ *   @endcode
+ *
+ *   The array parameters of `impl_template<kind, rank>` have to be fortran_array_wrappable types of element type `kind`
+ *   and rank `rank`. As the Fortran wrappers then differ in type, kind and rank of their arguments, the Fortran
+ *   compiler resolves a call of `name` to the matching specialization.
+ *
+ *   @param n The arity of the generated functions.
+ *   @param name The generic name of the generated functions, the specializations are named `name` followed by an index.
+ *   @param impl_template The template of the functor that the generated functions will delegate to.
+ *   @param kinds The sequence of element types, e.g. `(float)(double)`.
+ *   @param min_rank The smallest rank.
+ *   @param max_rank The largest rank.
+ */
+#define GEN_EXPORT_GENERIC_BINDING_PRODUCT_WRAPPED(n, name, impl_template, kinds, min_rank, max_rank) \
+    BOOST_PP_SEQ_FOR_EACH_I(GEN_EXPORT_GENERIC_BINDING_IMPL_FUNCTOR,                                  \
+        (_WRAPPED, n, name, impl_template),                                                           \
+        BOOST_PP_SEQ_FOR_EACH_PRODUCT(GEN_EXPORT_GENERIC_BINDING_PRODUCT_IMPL_PARAMS,                 \
+            (kinds)(BOOST_PP_REPEAT_FROM_TO(                                                          \
+                min_rank, BOOST_PP_INC(max_rank), GEN_EXPORT_GENERIC_BINDING_PRODUCT_IMPL_RANK, _)))) \
+    static_assert(1, "")
+
 /// GEN_EXPORT_BINDING_WITH_SIGNATURE shortcuts for the given arity
 #define GEN_EXPORT_BINDING_WITH_SIGNATURE_0(name, s, i) GEN_EXPORT_BINDING_WITH_SIGNATURE(0, name, s, i)
 #define GEN_EXPORT_BINDING_WITH_SIGNATURE_1(name, s, i) GEN_EXPORT_BINDING_WITH_SIGNATURE(1, name, s, i)
@@ -9,6 +9,7 @@
  */
 
 #pragma once
+#include <cassert>
 #include <functional>
 #include <stdexcept>
 #include <string>
@@ -58,11 +59,15 @@ namespace cpp_bindgen {
     template <class, class = void>
     struct fortran_array_element_kind;
     template <class T>
-    struct fortran_array_element_kind<T, enable_if_t<std::is_integral<T>::value>>
-        : _impl::fortran_array_element_kind_impl<typename std::make_signed<T>::type> {};
+    struct fortran_array_element_kind<T,
+        enable_if_t<std::is_integral<T>::value && !std::is_same<typename std::remove_cv<T>::type, bool>::value>>
+        : _impl::fortran_array_element_kind_impl<typename std::make_signed<typename std::remove_cv<T>::type>::type> {};
+    template <class T>
+    struct fortran_array_element_kind<T, enable_if_t<std::is_same<typename std::remove_cv<T>::type, bool>::value>>
+        : _impl::fortran_array_element_kind_impl<bool> {};
     template <class T>
     struct fortran_array_element_kind<T, enable_if_t<std::is_floating_point<T>::value>>
-        : _impl::fortran_array_element_kind_impl<T> {};
+        : _impl::fortran_array_element_kind_impl<typename std::remove_cv<T>::type> {};
 
     namespace get_fortran_view_meta_impl {
         template <class T, class Arr = remove_reference_t<T>, class ElementType = remove_all_extents_t<Arr>>
@@ -134,6 +139,112 @@ namespace cpp_bindgen {
         enable_if_t<std::is_same<decltype(get_fortran_view_meta(std::declval<add_pointer_t<T>>())),
             gen_fortran_array_descriptor>::value>> : std::true_type {};
 
+    namespace _impl {
+        template <class T>
+        struct is_c_array_ref : bool_constant<std::is_lvalue_reference<T>::value &&
+                                              std::is_array<remove_reference_t<T>>::value &&
+                                              std::is_arithmetic<remove_all_extents_t<remove_reference_t<T>>>::value> {
+        };
+
+        constexpr int nth_extent(int) { return 0; }
+        template <class... Ts>
+        constexpr int nth_extent(int i, int first, Ts... rest) {
+            return i == 0 ? first : nth_extent(i - 1, rest...);
+        }
+
+        template <gen_fortran_array_kind Kind, int Rank, bool IsAccPresent, class Extents = integer_sequence<int>>
+        struct static_fortran_view_meta;
+
+        template <gen_fortran_array_kind Kind, int Rank, bool IsAccPresent, int... Extents>
+        struct static_fortran_view_meta<Kind, Rank, IsAccPresent, integer_sequence<int, Extents...>> {
+            static_assert(sizeof...(Extents) == 0 || sizeof...(Extents) == Rank, "extents do not match the rank");
+
+            static constexpr gen_fortran_array_kind kind = Kind;
+            static constexpr int rank = Rank;
+            static constexpr bool is_acc_present = IsAccPresent;
+            static constexpr bool has_static_extents = sizeof...(Extents) != 0;
+            using extents = integer_sequence<int, Extents...>;
+
+            /// The i-th extent in Fortran order, 0 if the extents are not static.
+            static constexpr int extent(int i) { return nth_extent(i, Extents...); }
+        };
+        template <gen_fortran_array_kind Kind, int Rank, bool IsAccPresent, int... Extents>
+        constexpr gen_fortran_array_kind
+            static_fortran_view_meta<Kind, Rank, IsAccPresent, integer_sequence<int, Extents...>>::kind;
+        template <gen_fortran_array_kind Kind, int Rank, bool IsAccPresent, int... Extents>
+        constexpr int static_fortran_view_meta<Kind, Rank, IsAccPresent, integer_sequence<int, Extents...>>::rank;
+        template <gen_fortran_array_kind Kind, int Rank, bool IsAccPresent, int... Extents>
+        constexpr bool
+            static_fortran_view_meta<Kind, Rank, IsAccPresent, integer_sequence<int, Extents...>>::is_acc_present;
+        template <gen_fortran_array_kind Kind, int Rank, bool IsAccPresent, int... Extents>
+        constexpr bool
+            static_fortran_view_meta<Kind, Rank, IsAccPresent, integer_sequence<int, Extents...>>::has_static_extents;
+
+        /// The extents of the C array `Arr` in Fortran order, i.e. reversed.
+        template <class Arr, class = make_index_sequence<std::rank<Arr>::value>>
+        struct c_array_fortran_extents;
+        template <class Arr, std::size_t... Is>
+        struct c_array_fortran_extents<Arr, index_sequence<Is...>> {
+            using type = integer_sequence<int, int(std::extent<Arr, sizeof...(Is) - 1 - Is>::value)...>;
+        };
+
+        template <class T, class = void>
+        struct view_extents {
+            using type = integer_sequence<int>;
+        };
+        template <class T>
+        struct view_extents<T, enable_if_t<(T::gen_view_extents::size() >= 0)>> {
+            using type = typename T::gen_view_extents;
+        };
+    } // namespace _impl
+
+    /**
+     * The compile time meta data of a fortran_array_view_inspectable type `T`, the constexpr counterpart of
+     * get_fortran_view_meta(). It provides the static members `kind`, `rank`, `is_acc_present` and
+     * `has_static_extents`, the Fortran extents (in the order of gen_fortran_array_descriptor::dims) as the
+     * `extents` integer_sequence and `extent(i)`.
+     *
+     * It is defined for references to C arrays, whose extents are always static, and for types defining the
+     * gen_view_* member types, which can define `gen_view_extents` as `integer_sequence<int, ...>` of their Fortran
+     * extents. It can be specialized for other types, types only providing get_fortran_view_meta() fall back to the
+     * runtime meta data.
+     */
+    template <class T, class = void>
+    struct fortran_view_meta {};
+
+    template <class T>
+    struct fortran_view_meta<T, enable_if_t<_impl::is_c_array_ref<T>::value>>
+        : _impl::static_fortran_view_meta<
+              fortran_array_element_kind<remove_all_extents_t<remove_reference_t<T>>>::value,
+              std::rank<remove_reference_t<T>>::value,
+              false,
+              typename _impl::c_array_fortran_extents<remove_reference_t<T>>::type> {};
+
+    template <class T>
+    struct fortran_view_meta<T,
+        enable_if_t<(T::gen_view_rank::value > 0) && std::is_arithmetic<typename T::gen_view_element_type>::value &&
+                    (T::gen_is_acc_present::value == T::gen_is_acc_present::value)>>
+        : _impl::static_fortran_view_meta<fortran_array_element_kind<typename T::gen_view_element_type>::value,
+              T::gen_view_rank::value,
+              T::gen_is_acc_present::value,
+              typename _impl::view_extents<T>::type> {};
+
+#ifdef CPP_BINDGEN_GT_LEGACY // remove once GT is at v2.0
+    template <class T>
+    struct fortran_view_meta<T,
+        enable_if_t<(T::gt_view_rank::value > 0) && std::is_arithmetic<typename T::gt_view_element_type>::value &&
+                    (T::gt_is_acc_present::value == T::gt_is_acc_present::value)>>
+        : _impl::static_fortran_view_meta<fortran_array_element_kind<typename T::gt_view_element_type>::value,
+              T::gt_view_rank::value,
+              T::gt_is_acc_present::value> {};
+#endif
+
+    /// Whether fortran_view_meta is defined for `T`.
+    template <class T, class = void>
+    struct has_static_fortran_view_meta : std::false_type {};
+    template <class T>
+    struct has_static_fortran_view_meta<T, enable_if_t<(fortran_view_meta<T>::rank > 0)>> : std::true_type {};
+
     /**
      * The concept of fortran_array_convertible requires that a fortran array described by a
      * gen_fortran_array_descriptor can be converted into T:
@@ -200,25 +311,43 @@ namespace cpp_bindgen {
     make_fortran_array_view(gen_fortran_array_descriptor *descriptor) {
         return *descriptor;
     }
-    template <class T>
-    enable_if_t<std::is_lvalue_reference<T>::value && std::is_array<remove_reference_t<T>>::value &&
-                    std::is_arithmetic<remove_all_extents_t<remove_reference_t<T>>>::value,
-        T>
-    make_fortran_array_view(gen_fortran_array_descriptor *descriptor) {
-        static gen_fortran_array_descriptor cpp_meta = get_fortran_view_meta((add_pointer_t<T>){nullptr});
-        if (descriptor->type != cpp_meta.type) {
-            throw std::runtime_error("Types do not match: fortran-type (" + std::to_string(descriptor->type) +
-                                     ") != c-type (" + std::to_string(cpp_meta.type) + ")");
+    namespace _impl {
+        /// Checks the descriptor against the static meta data `Meta` (see fortran_view_meta).
+        template <class Meta, int... Extents>
+        bool fortran_array_matches(gen_fortran_array_descriptor const &descriptor, integer_sequence<int, Extents...>) {
+            bool res = descriptor.type == Meta::kind && descriptor.rank == Meta::rank;
+            int i = 0;
+            (void)(int[]){0, (res = res && descriptor.dims[i++] == Extents, 0)...};
+            return res;
         }
-        if (descriptor->rank != cpp_meta.rank) {
-            throw std::runtime_error("Rank does not match: fortran-rank (" + std::to_string(descriptor->rank) +
-                                     ") != c-rank (" + std::to_string(cpp_meta.rank) + ")");
+
+        /// Checks the descriptor against the compile time meta data of the C array type `Arr`.
+        template <class Arr>
+        bool fortran_array_matches(gen_fortran_array_descriptor const &descriptor) {
+            using meta_t = fortran_view_meta<Arr &>;
+            return fortran_array_matches<meta_t>(descriptor, typename meta_t::extents{});
         }
-        for (int i = 0; i < descriptor->rank; ++i) {
-            if (cpp_meta.dims[i] != descriptor->dims[descriptor->rank - i - 1])
-                throw std::runtime_error("Extents do not match");
+
+        /// Reports why fortran_array_matches() failed; kept apart to keep the string formatting off the call path.
+        inline void throw_fortran_array_mismatch(
+            gen_fortran_array_descriptor const &descriptor, gen_fortran_array_kind kind, int rank) {
+            if (descriptor.type != kind) {
+                throw std::runtime_error("Types do not match: fortran-type (" + std::to_string(descriptor.type) +
+                                         ") != c-type (" + std::to_string(kind) + ")");
+            }
+            if (descriptor.rank != rank) {
+                throw std::runtime_error("Rank does not match: fortran-rank (" + std::to_string(descriptor.rank) +
+                                         ") != c-rank (" + std::to_string(rank) + ")");
+            }
+            throw std::runtime_error("Extents do not match");
         }
+    } // namespace _impl
 
+    template <class T>
+    enable_if_t<_impl::is_c_array_ref<T>::value, T> make_fortran_array_view(gen_fortran_array_descriptor *descriptor) {
+        using meta_t = fortran_view_meta<T>;
+        if (!_impl::fortran_array_matches<meta_t>(*descriptor, typename meta_t::extents{}))
+            _impl::throw_fortran_array_mismatch(*descriptor, meta_t::kind, meta_t::rank);
         return *reinterpret_cast<remove_reference_t<T> *>(descriptor->data);
     }
     template <class T>
@@ -240,6 +369,23 @@ namespace cpp_bindgen {
         return gt_make_fortran_array_view(descriptor, (T *){nullptr});
     }
 #endif
+
+    /**
+     * The flavour of make_fortran_array_view() used by trusted bindings (see wrap_trusted()): C arrays are not validated
+     * against the descriptor, unless assertions are enabled. All other types are converted by make_fortran_array_view().
+     */
+    template <class T>
+    enable_if_t<_impl::is_c_array_ref<T>::value, T> make_trusted_fortran_array_view(
+        gen_fortran_array_descriptor *descriptor) {
+        assert(_impl::fortran_array_matches<remove_reference_t<T>>(*descriptor) &&
+               "the Fortran array does not match the C array type");
+        return *reinterpret_cast<remove_reference_t<T> *>(descriptor->data);
+    }
+    template <class T>
+    enable_if_t<!_impl::is_c_array_ref<T>::value, T> make_trusted_fortran_array_view(
+        gen_fortran_array_descriptor *descriptor) {
+        return make_fortran_array_view<T>(descriptor);
+    }
 } // namespace cpp_bindgen
 
 #ifdef CPP_BINDGEN_GT_LEGACY // remove once GT is at v2.0
@@ -9,14 +9,22 @@
  */
 #pragma once
 
+#include <cstddef>
+#include <tuple>
 #include <type_traits>
+#include <utility>
 
 #include <stdbool.h>
 
 #include "common/any_moveable.hpp"
+#include "common/conjunction.hpp"
+#include "common/make_indices.hpp"
+#include "common/type_traits.hpp"
 
+#include "bound_array.hpp"
 #include "fortran_array_view.hpp"
 #include "handle_impl.hpp"
+#include "scratch.hpp"
 
 namespace cpp_bindgen {
     namespace _impl {
@@ -105,30 +113,156 @@ namespace cpp_bindgen {
         T convert_from_c(gen_handle *obj) {
             return &any_cast<remove_pointer_t<T> &>(obj->m_value);
         }
-        template <class T, typename std::enable_if<!std::is_pointer<T>::value, int>::type = 0>
+        template <class T,
+            typename std::enable_if<!std::is_pointer<T>::value && !is_bound_array<decay_t<T>>::value, int>::type = 0>
         T convert_from_c(gen_handle *obj) {
             return any_cast<T>(obj->m_value);
         }
+        template <class T, typename std::enable_if<is_bound_array<decay_t<T>>::value, int>::type = 0>
+        T convert_from_c(gen_handle *obj) {
+            static_assert(!std::is_reference<T>::value, "bound_array parameters must be passed by value");
+            return T(any_cast<bound_array_storage &>(obj->m_value));
+        }
         template <class T>
         T convert_from_c(gen_fortran_array_descriptor *obj) {
             return make_fortran_array_view<T>(obj);
         }
 
+        /// Converts a parameter like convert_from_c(), with the C arrays of trusted bindings left unchecked.
+        template <class T, bool Trusted>
+        struct param_from_c_f {
+            template <class Arg>
+            T operator()(Arg arg) const {
+                return convert_from_c<T>(arg);
+            }
+        };
+
+        template <class T>
+        struct param_from_c_f<T, true> {
+            T operator()(gen_fortran_array_descriptor *obj) const { return make_trusted_fortran_array_view<T>(obj); }
+            template <class Arg>
+            T operator()(Arg arg) const {
+                return convert_from_c<T>(arg);
+            }
+        };
+
+        template <class T>
+        struct is_scratch : std::is_same<T, scratch &> {};
+
+        template <class R, class Done, class... Params>
+        struct remove_scratch_params;
+
+        template <class R, class... Done>
+        struct remove_scratch_params<R, list<Done...>> {
+            using type = R(Done...);
+        };
+
+        template <class R, class... Done, class Param, class... Params>
+        struct remove_scratch_params<R, list<Done...>, Param, Params...>
+            : remove_scratch_params<R,
+                  typename std::conditional<is_scratch<Param>::value, list<Done...>, list<Done..., Param>>::type,
+                  Params...> {};
+
+        template <class T>
+        struct scratch_free_signature;
+
+        template <class T>
+        struct scratch_free_signature<T *> : scratch_free_signature<T> {};
+
+        template <class T>
+        struct scratch_free_signature<T &> : scratch_free_signature<T> {};
+
+        template <class R, class... Params>
+        struct scratch_free_signature<R(Params...)> : remove_scratch_params<R, list<>, Params...> {};
+
+        /// The number of `scratch &` parameters among the first `I` parameters.
+        template <std::size_t I, class... Params>
+        struct scratch_params_before : std::integral_constant<std::size_t, 0> {};
+
+        template <std::size_t I, class Param, class... Params>
+        struct scratch_params_before<I, Param, Params...>
+            : std::integral_constant<std::size_t,
+                  I == 0 ? 0 : is_scratch<Param>::value + scratch_params_before<I - 1, Params...>::value> {};
+
+        /// Selects the argument for a parameter of type `Param`, which is the `J`-th argument passed by the caller.
+        template <class Param, std::size_t J>
+        struct scratch_arg {
+            template <class Args>
+            static typename std::tuple_element<J, Args>::type get(scratch &, Args &args) {
+                return std::forward<typename std::tuple_element<J, Args>::type>(std::get<J>(args));
+            }
+        };
+
+        template <std::size_t J>
+        struct scratch_arg<scratch &, J> {
+            template <class Args>
+            static scratch &get(scratch &arena, Args &) {
+                return arena;
+            }
+        };
+
+        /// Calls `Impl` with the arguments for the parameters that are not `scratch &`, and the arena of the calling
+        /// thread for the `scratch &` parameters. The arena is reset when the call returns.
         template <class T, class Impl>
-        struct wrapped_f;
+        struct scratch_injected_f;
 
         template <class R, class... Params, class Impl>
-        struct wrapped_f<R(Params...), Impl> {
+        struct scratch_injected_f<R(Params...), Impl> {
+            Impl m_fun;
+
+            template <class Args, std::size_t... Is>
+            R invoke(scratch &arena, Args &args, index_sequence<Is...>) const {
+                return m_fun(
+                    scratch_arg<Params, Is - scratch_params_before<Is, Params...>::value>::get(arena, args)...);
+            }
+
+            template <class... Args>
+            R operator()(Args &&... args) const {
+                scratch &arena = thread_scratch();
+                scratch_scope scope(arena);
+                auto tuple = std::forward_as_tuple(std::forward<Args>(args)...);
+                return invoke(arena, tuple, make_index_sequence<sizeof...(Params)>{});
+            }
+        };
+
+        template <class T, class Impl, bool = !std::is_same<typename scratch_free_signature<T>::type, T>::value>
+        struct scratch_injected {
+            using type = Impl;
+            static constexpr type make(Impl obj) { return obj; }
+        };
+
+        template <class T, class Impl>
+        struct scratch_injected<T, Impl, true> {
+            using type = scratch_injected_f<T, Impl>;
+            static constexpr type make(Impl obj) { return {obj}; }
+        };
+
+        /// `Impl` itself if `T` has no `scratch &` parameters, scratch_injected_f otherwise.
+        template <class T, class Impl>
+        using scratch_injected_t = typename scratch_injected<T, Impl>::type;
+
+        template <class T, class Impl>
+        constexpr scratch_injected_t<T, decay_t<Impl>> inject_scratch(Impl &&obj) {
+            return scratch_injected<T, decay_t<Impl>>::make(std::forward<Impl>(obj));
+        }
+
+        template <class T, class Impl, bool Trusted = false>
+        struct wrapped_f;
+
+        template <class R, class... Params, class Impl, bool Trusted>
+        struct wrapped_f<R(Params...), Impl, Trusted> {
             Impl m_fun;
             result_converted_to_c_t<R> operator()(param_converted_to_c_t<Params>... args) const {
-                return convert_to_c(m_fun(convert_from_c<Params>(args)...));
+                return convert_to_c(m_fun(param_from_c_f<Params, Trusted>{}(args)...));
             }
         };
 
-        template <class... Params, class Impl>
-        struct wrapped_f<void(Params...), Impl> {
+        template <class... Params, class Impl, bool Trusted>
+        struct wrapped_f<void(Params...), Impl, Trusted> {
             Impl m_fun;
-            void operator()(param_converted_to_c_t<Params>... args) const { m_fun(convert_from_c<Params>(args)...); }
+            void operator()(param_converted_to_c_t<Params>... args) const {
+                m_fun(param_from_c_f<Params, Trusted>{}(args)...);
+            }
         };
 
         template <class T>
@@ -148,21 +282,123 @@ namespace cpp_bindgen {
         struct wrapped<R(Params...)> {
             using type = result_converted_to_c_t<R>(typename param_converted_to_c<Params>::type...);
         };
+
+        template <class T>
+        struct is_nothrow_converted_param
+            : bool_constant<std::is_arithmetic<remove_pointer_t<remove_reference_t<T>>>::value> {};
+
+        /**
+         * True if the wrapper of `Impl` for the signature `T` cannot throw: the parameters and the result of `T` are
+         * arithmetic types (or pointers or references to them), the conversions of which cannot throw, and the call of
+         * `Impl` is noexcept.
+         */
+        template <class Impl, class T, class = void>
+        struct is_nothrow_wrapped : std::false_type {};
+
+        template <class Impl, class R, class... Params>
+        struct is_nothrow_wrapped<Impl,
+            R(Params...),
+            enable_if_t<(std::is_void<R>::value || std::is_arithmetic<R>::value) &&
+                        conjunction<is_nothrow_converted_param<Params>...>::value>>
+            : bool_constant<noexcept(std::declval<Impl const &>()(std::declval<Params>()...))> {};
+
+        /// Whether the functor returned by `wrap<T>(obj)` cannot throw, see is_nothrow_wrapped.
+        template <class T, class Impl>
+        constexpr bool is_nothrow_wrap(Impl &&) {
+            return is_nothrow_wrapped<decay_t<Impl>, T>::value;
+        }
+
+        /// Specialization for function pointers.
+        template <class T>
+        constexpr bool is_nothrow_wrap(T *) {
+            return is_nothrow_wrapped<T *, T>::value;
+        }
+
+        template <class T>
+        struct is_identity_param
+            : bool_constant<std::is_arithmetic<T>::value ||
+                            (std::is_pointer<T>::value && std::is_arithmetic<remove_pointer_t<T>>::value)> {};
+
+        /// True if `T` is its own wrapped signature: arithmetic values and pointers to arithmetic types only.
+        template <class T>
+        struct is_identity_signature : std::false_type {};
+
+        template <class R, class... Params>
+        struct is_identity_signature<R(Params...)>
+            : bool_constant<(std::is_void<R>::value || std::is_arithmetic<R>::value) &&
+                            conjunction<is_identity_param<Params>...>::value> {};
+
+        template <class T, bool Trusted, class Impl>
+        constexpr decay_t<Impl> wrap_elided(std::true_type, Impl &&obj) {
+            return std::forward<Impl>(obj);
+        }
+
+        template <class T, bool Trusted, class Impl>
+        constexpr wrapped_f<typename scratch_free_signature<T>::type, scratch_injected_t<T, decay_t<Impl>>, Trusted>
+        wrap_elided(std::false_type, Impl &&obj) {
+            return {inject_scratch<T>(std::forward<Impl>(obj))};
+        }
     } // namespace _impl
 
+    /**
+     * Transform a function type to the function type without its `scratch &` parameters. Those parameters are not
+     * passed by the caller, the wrappers pass the scratch arena of the calling thread instead, see thread_scratch().
+     */
+    template <class T>
+    using scratch_free_signature_t = typename _impl::scratch_free_signature<T>::type;
+
     /// Transform a function type to to the function type that is callable from C
     template <class T>
-    using wrapped_t = typename _impl::wrapped<T>::type;
+    using wrapped_t = typename _impl::wrapped<scratch_free_signature_t<T>>::type;
 
-    /// Wrap the functor of type `Impl` to another functor that can be invoked with the 'wrapped_t<T>' signature.
+    /**
+     * Wrap the functor of type `Impl` to another functor that can be invoked with the 'wrapped_t<T>' signature.
+     *
+     * The `scratch &` parameters of `T` are bound to the arena of the calling thread, everything allocated from it
+     * during the call is released when `Impl` returns (hence the result must not refer to that memory).
+     */
     template <class T, class Impl>
-    constexpr _impl::wrapped_f<T, typename std::decay<Impl>::type> wrap(Impl &&obj) {
-        return {std::forward<Impl>(obj)};
+    constexpr _impl::wrapped_f<scratch_free_signature_t<T>, _impl::scratch_injected_t<T, decay_t<Impl>>>
+    wrap(Impl &&obj) {
+        return {_impl::inject_scratch<T>(std::forward<Impl>(obj))};
     }
 
     /// Specialization for function pointers.
     template <class T>
-    constexpr _impl::wrapped_f<T, T *> wrap(T *obj) {
-        return {obj};
+    constexpr _impl::wrapped_f<scratch_free_signature_t<T>, _impl::scratch_injected_t<T, T *>> wrap(T *obj) {
+        return {_impl::inject_scratch<T>(obj)};
+    }
+
+    /// The flavour of `wrap<T>` that does not validate the Fortran arrays passed for C array parameters (unless
+    /// assertions are enabled), see make_trusted_fortran_array_view().
+    template <class T, class Impl>
+    constexpr _impl::wrapped_f<scratch_free_signature_t<T>, _impl::scratch_injected_t<T, decay_t<Impl>>, true>
+    wrap_trusted(Impl &&obj) {
+        return {_impl::inject_scratch<T>(std::forward<Impl>(obj))};
+    }
+
+    /// Specialization for function pointers.
+    template <class T>
+    constexpr _impl::wrapped_f<scratch_free_signature_t<T>, _impl::scratch_injected_t<T, T *>, true>
+    wrap_trusted(T *obj) {
+        return {_impl::inject_scratch<T>(obj)};
+    }
+
+    /**
+     * `wrap<T>(obj)` (or `wrap_trusted<T>(obj)`), except for the signatures `T` made only of arithmetic values and
+     * pointers to arithmetic types: as their wrapper would only forward the arguments, `obj` itself is returned. The
+     * generated functions of such signatures then call `obj` directly, which they do as a tail call.
+     */
+    template <class T, bool Trusted = false, class Impl>
+    constexpr auto wrap_elided(Impl &&obj)
+        -> decltype(_impl::wrap_elided<T, Trusted>(_impl::is_identity_signature<T>{}, std::forward<Impl>(obj))) {
+        return _impl::wrap_elided<T, Trusted>(_impl::is_identity_signature<T>{}, std::forward<Impl>(obj));
+    }
+
+    /// Specialization for function pointers.
+    template <class T, bool Trusted = false>
+    constexpr auto wrap_elided(T *obj)
+        -> decltype(_impl::wrap_elided<T, Trusted>(_impl::is_identity_signature<T>{}, obj)) {
+        return _impl::wrap_elided<T, Trusted>(_impl::is_identity_signature<T>{}, obj);
     }
 } // namespace cpp_bindgen
@@ -9,100 +9,156 @@
  */
 #pragma once
 
+// Production libraries are compiled with CPP_BINDGEN_NO_DECLARATIONS: they carry no meta data for the generator, which
+// is built from the same sources and definitions plus CPP_BINDGEN_DECLARATIONS, see cpp_bindgen_add_library().
+#if !defined(CPP_BINDGEN_NO_DECLARATIONS) || defined(CPP_BINDGEN_DECLARATIONS)
+#define GEN_DECLARATIONS_IMPL 1
+#else
+#define GEN_DECLARATIONS_IMPL 0
+#endif
+
+#if GEN_DECLARATIONS_IMPL
 #include <cassert>
 #include <cstring>
-#include <functional>
-#include <map>
 #include <ostream>
-#include <sstream>
 #include <string>
-#include <vector>
-
-#include <boost/type_index.hpp>
 
 #include "common/disjunction.hpp"
-#include "common/for_each.hpp"
 #include "common/function_traits.hpp"
 
+#include "elemental.hpp"
 #include "function_wrapper.hpp"
 
 namespace cpp_bindgen {
 
     std::string wrap_line(const std::string &line, const std::string &prefix);
 
+    /// Writes `line` as wrap_line() does, without building the wrapped string.
+    void write_wrapped_line(std::ostream &strm, const std::string &line, const std::string &prefix);
+
     namespace _impl {
 
         struct c_string_less {
             bool operator()(char const *lhs, char const *rhs) const { return strcmp(lhs, rhs) < 0; }
         };
 
-        class entities {
-            using generator_t = std::function<void(std::ostream &, char const *)>;
-            std::map<char const *, generator_t, c_string_less> m_generators;
-
-          public:
-            void add(char const *name, generator_t generator);
-            friend std::ostream &operator<<(std::ostream &strm, entities const &obj);
-        };
-
         template <class>
-        entities &get_entities() {
-            static entities obj;
-            return obj;
+        struct c_type_tag {};
+
+        /// The names of the unqualified types in C signatures, the qualifiers and pointers are added by write_c_type().
+        constexpr char const *c_type_name(c_type_tag<void>) { return "void"; }
+        constexpr char const *c_type_name(c_type_tag<bool>) { return "bool"; }
+        constexpr char const *c_type_name(c_type_tag<char>) { return "char"; }
+        constexpr char const *c_type_name(c_type_tag<signed char>) { return "signed char"; }
+        constexpr char const *c_type_name(c_type_tag<unsigned char>) { return "unsigned char"; }
+        constexpr char const *c_type_name(c_type_tag<short>) { return "short"; }
+        constexpr char const *c_type_name(c_type_tag<unsigned short>) { return "unsigned short"; }
+        constexpr char const *c_type_name(c_type_tag<int>) { return "int"; }
+        constexpr char const *c_type_name(c_type_tag<unsigned int>) { return "unsigned int"; }
+        constexpr char const *c_type_name(c_type_tag<long>) { return "long"; }
+        constexpr char const *c_type_name(c_type_tag<unsigned long>) { return "unsigned long"; }
+        constexpr char const *c_type_name(c_type_tag<long long>) { return "long long"; }
+        constexpr char const *c_type_name(c_type_tag<unsigned long long>) { return "unsigned long long"; }
+        constexpr char const *c_type_name(c_type_tag<float>) { return "float"; }
+        constexpr char const *c_type_name(c_type_tag<double>) { return "double"; }
+        constexpr char const *c_type_name(c_type_tag<long double>) { return "long double"; }
+        constexpr char const *c_type_name(c_type_tag<gen_handle>) { return "gen_handle"; }
+        constexpr char const *c_type_name(c_type_tag<gen_fortran_array_descriptor>) {
+            return "gen_fortran_array_descriptor";
         }
 
-        template <class T, class = void>
-        struct recursive_remove_cv : std::remove_cv<T> {};
+        /// Other types have no name in the generated C header, they could only appear in declarations added by hand.
+        template <class T>
+        char const *c_type_name(c_type_tag<T>) {
+            static_assert(!std::is_same<T, T>::value, "the type can not be used in C signatures");
+            return "";
+        }
 
         template <class T>
-        struct recursive_remove_cv<T, typename std::enable_if<std::is_pointer<T>::value>::type> {
-            using type = typename recursive_remove_cv<typename std::remove_pointer<T>::type>::type *;
+        struct c_type_writer {
+            static void write(std::ostream &strm) { strm << c_type_name(c_type_tag<T>{}); }
         };
-
-        struct get_c_type_name_f {
-            template <class T>
-            std::string operator()() const {
-                return boost::typeindex::type_id<typename recursive_remove_cv<T>::type>().pretty_name();
+        template <class T>
+        struct c_type_writer<T const> {
+            static void write(std::ostream &strm) {
+                c_type_writer<T>::write(strm);
+                strm << " const";
+            }
+        };
+        template <class T>
+        struct c_type_writer<T volatile> {
+            static void write(std::ostream &strm) {
+                c_type_writer<T>::write(strm);
+                strm << " volatile";
+            }
+        };
+        template <class T>
+        struct c_type_writer<T const volatile> {
+            static void write(std::ostream &strm) {
+                c_type_writer<T>::write(strm);
+                strm << " const volatile";
+            }
+        };
+        template <class T>
+        struct c_type_writer<T *> {
+            static void write(std::ostream &strm) {
+                c_type_writer<T>::write(strm);
+                strm << "*";
             }
         };
 
+        // only the top level qualifiers are dropped, `double const *` stays read-only in the C header
         template <class T>
-        std::string get_c_type_name() {
-            return boost::typeindex::type_id<typename recursive_remove_cv<T>::type>().pretty_name();
+        void write_c_type(std::ostream &strm) {
+            c_type_writer<typename std::remove_cv<T>::type>::write(strm);
         }
 
-        template <class TypeToStr, class Fun>
-        struct for_each_param_helper_f {
-            TypeToStr m_type_to_str;
-            Fun m_fun;
-            int &m_count;
+        /// Parameters that are restrict-qualified in the C header of libraries with the RESTRICT option.
+        template <class T>
+        struct is_c_array_param
+            : bool_constant<std::is_pointer<T>::value && std::is_arithmetic<remove_pointer_t<T>>::value> {};
 
-            template <class T>
-            void operator()() const {
-                m_fun(m_type_to_str.template operator()<T>(), m_count);
-                ++m_count;
-            }
+        /**
+         * The attributes of a prototype in the generated C header, see c_attributes.h. They are registered by the
+         * definitions of the bindings, which know the C++ signature.
+         */
+        struct c_attributes_record {
+            char const *m_name;
+            bool const *m_nonnull; // for each parameter
+            bool m_restrict;
+            bool m_nothrow;
         };
 
-        template <class Signature,
-            class TypeToStr,
-            class Fun,
-            class Params = typename function_traits::parameter_types<Signature>::type>
-        void for_each_param(TypeToStr &&type_to_str, Fun &&fun) {
-            int count = 0;
-            for_each_type<Params>(for_each_param_helper_f<TypeToStr, Fun>{
-                std::forward<TypeToStr>(type_to_str), std::forward<Fun>(fun), count});
+        c_attributes_record const *find_c_attributes_record(char const *name);
+
+        /// Handles and descriptors are dereferenced by the bindings, other pointers in C signatures might be null.
+        template <class T>
+        struct is_nonnull_c_param
+            : disjunction<std::is_same<typename std::remove_cv<T>::type, gen_handle *>,
+                  std::is_same<typename std::remove_cv<T>::type, gen_fortran_array_descriptor *>> {};
+
+        /// Parameters of C++ signatures converted to pointers, which are dereferenced unless they are C++ pointers.
+        template <class T>
+        struct is_nonnull_cpp_param
+            : bool_constant<std::is_pointer<param_converted_to_c_t<T>>::value &&
+                            !(std::is_pointer<T>::value && std::is_arithmetic<remove_pointer_t<T>>::value)> {};
+
+        template <class CppSignature>
+        struct nonnull_cpp_params;
+
+        template <class R, class... Params>
+        struct nonnull_cpp_params<R(Params...)> {
+            static constexpr bool value[sizeof...(Params) + 1] = {is_nonnull_cpp_param<Params>::value..., false};
         };
+        template <class R, class... Params>
+        constexpr bool nonnull_cpp_params<R(Params...)>::value[sizeof...(Params) + 1];
 
-        template <class CSignature>
-        std::ostream &write_c_binding(std::ostream &strm, char const *name) {
-            strm << get_c_type_name<typename function_traits::result_type<CSignature>::type>() << " " << name << "(";
-            for_each_param<CSignature>(get_c_type_name_f{}, [&](const std::string &type_name, int i) {
-                if (i)
-                    strm << ", ";
-                strm << type_name;
-            });
-            return strm << ");\n";
+        template <class CppSignature>
+        constexpr c_attributes_record c_attributes(char const *name, bool restrict_pointers, bool nothrow) {
+            return {name,
+                nonnull_cpp_params<scratch_free_signature_t<CppSignature>>::value,
+                restrict_pointers,
+                nothrow};
         }
 
         template <class>
@@ -164,35 +220,38 @@ namespace cpp_bindgen {
             return "";
         }
 
-        template <class T, typename std::enable_if<std::is_void<T>::value, int>::type = 0>
-        std::string fortran_function_specifier() {
-            return "subroutine";
-        }
+        std::string fortran_array_element_type_name(gen_fortran_array_kind kind);
 
-        template <class T, typename std::enable_if<!std::is_void<T>::value, int>::type = 0>
-        std::string fortran_function_specifier() {
-            return "function";
+        /// `intent(in)` for arrays that are only read by the C++ side, `intent(inout)` otherwise.
+        template <class Element>
+        std::string fortran_intent() {
+            return std::is_const<Element>::value ? "intent(in)" : "intent(inout)";
         }
 
-        template <class T, typename std::enable_if<std::is_void<T>::value, int>::type = 0>
-        std::string fortran_return_type() {
-            return fortran_function_specifier<T>();
-        }
+        /// The (possibly const) element type of a C++ parameter that is bound to a Fortran array.
+        template <class T, class = void>
+        struct fortran_array_element {
+            using type = remove_all_extents_t<remove_reference_t<T>>;
+        };
+        template <class T>
+        struct fortran_array_element<T, void_t<typename decay_t<T>::gen_view_element_type>> {
+            using type = typename decay_t<T>::gen_view_element_type;
+        };
 
-        template <class T, typename std::enable_if<!std::is_void<T>::value, int>::type = 0>
-        std::string fortran_return_type() {
-            return fortran_type_name<T>() + " " + fortran_function_specifier<T>();
+        /**
+         * The attributes of a wrapped array following its `dimension(...)`: assumed-shape arrays are `contiguous`, as
+         * the C++ side sees them as dense blocks, and all of them are `target`, as their address is taken by `c_loc`.
+         *
+         * The arrays of deferred bindings (see declaration_record::m_deferred) are assumed-shape without `contiguous`:
+         * the compiler would pass a temporary copy of a non-contiguous actual argument, which is gone by the time the
+         * call is executed. Their wrappers reject non-contiguous arrays instead.
+         */
+        template <class CppType>
+        std::string fortran_array_attributes(bool contiguous) {
+            return std::string(contiguous ? ", contiguous, " : ", ") +
+                   fortran_intent<typename fortran_array_element<CppType>::type>() + ", target";
         }
 
-        std::string fortran_array_element_type_name(gen_fortran_array_kind kind);
-
-        struct ignore_type_f {
-            template <class T>
-            std::string operator()() const {
-                return "";
-            }
-        };
-
         struct fortran_param_type_from_c_f {
 
             template <class CType,
@@ -215,7 +274,8 @@ namespace cpp_bindgen {
                                             std::is_arithmetic<typename std::remove_pointer<CType>::type>::value,
                     int>::type = 0>
             std::string operator()() const {
-                return fortran_type_name<typename std::remove_pointer<CType>::type>() + ", dimension(*)";
+                using element_t = typename std::remove_pointer<CType>::type;
+                return fortran_type_name<element_t>() + ", dimension(*), " + fortran_intent<element_t>();
             }
             template <class CType,
                 typename std::enable_if<std::is_pointer<CType>::value &&
@@ -226,24 +286,65 @@ namespace cpp_bindgen {
                 return "type(c_ptr)";
             }
         };
+        /**
+         * The `dimension(...)` attribute of a wrapped array. It is assumed-shape even if the extents are static: the
+         * wrapper checks the shape of the actual argument against them, an explicit-shape dummy would accept any array
+         * by sequence association.
+         */
+        inline std::string fortran_assumed_shape(int rank) {
+            std::string dimensions = "dimension(";
+            for (int i = 0; i < rank; ++i) {
+                if (i)
+                    dimensions += ",";
+                dimensions += ":";
+            }
+            return dimensions + ")";
+        }
+
+        /// Whether the Fortran extents of the wrapped array `CppType` are known at compile time, see fortran_view_meta.
+        template <class CppType, class = void>
+        struct has_static_fortran_extents : std::false_type {};
+        template <class CppType>
+        struct has_static_fortran_extents<CppType, enable_if_t<has_static_fortran_view_meta<CppType>::value>>
+            : std::integral_constant<bool, fortran_view_meta<CppType>::has_static_extents> {};
+
+        /// The meta data of a type with fortran_view_meta as a gen_fortran_array_descriptor constant.
+        template <class CppType, class Meta = fortran_view_meta<CppType>, class = typename Meta::extents>
+        struct static_fortran_view_descriptor;
+        template <class CppType, class Meta, int... Extents>
+        struct static_fortran_view_descriptor<CppType, Meta, integer_sequence<int, Extents...>> {
+            static constexpr gen_fortran_array_descriptor value = {
+                Meta::kind, Meta::rank, {Extents...}, nullptr, Meta::is_acc_present};
+        };
+        template <class CppType, class Meta, int... Extents>
+        constexpr gen_fortran_array_descriptor
+            static_fortran_view_descriptor<CppType, Meta, integer_sequence<int, Extents...>>::value;
+
         struct fortran_param_type_from_cpp_f {
 
             template <class CppType,
                 class CType = param_converted_to_c_t<CppType>,
                 typename std::enable_if<std::is_same<CType, gen_fortran_array_descriptor *>::value &&
-                                            is_fortran_array_wrappable<CppType>::value,
+                                            is_fortran_array_wrappable<CppType>::value &&
+                                            has_static_fortran_view_meta<CppType>::value,
                     int>::type = 0>
-            std::string operator()() const {
+            std::string operator()(bool deferred) const {
+                using meta_t = fortran_view_meta<CppType>;
+                return fortran_array_element_type_name(meta_t::kind) + ", " + fortran_assumed_shape(meta_t::rank) +
+                       fortran_array_attributes<CppType>(!deferred);
+            }
+
+            template <class CppType,
+                class CType = param_converted_to_c_t<CppType>,
+                typename std::enable_if<std::is_same<CType, gen_fortran_array_descriptor *>::value &&
+                                            is_fortran_array_wrappable<CppType>::value &&
+                                            !has_static_fortran_view_meta<CppType>::value,
+                    int>::type = 0>
+            std::string operator()(bool deferred) const {
                 static const gen_fortran_array_descriptor meta =
                     get_fortran_view_meta((add_pointer_t<CppType>){nullptr});
-                std::string dimensions = "dimension(";
-                for (int i = 0; i < meta.rank; ++i) {
-                    if (i)
-                        dimensions += ",";
-                    dimensions += ":";
-                }
-                dimensions += ")";
-                return fortran_array_element_type_name(meta.type) + ", " + dimensions;
+                return fortran_array_element_type_name(meta.type) + ", " + fortran_assumed_shape(meta.rank) +
+                       fortran_array_attributes<CppType>(!deferred);
             }
 
             template <class CppType,
@@ -251,57 +352,26 @@ namespace cpp_bindgen {
                 typename std::enable_if<!std::is_same<CType, gen_fortran_array_descriptor *>::value ||
                                             !is_fortran_array_wrappable<CppType>::value,
                     int>::type = 0>
-            std::string operator()() const {
+            std::string operator()(bool) const {
                 return fortran_param_type_from_c_f{}.template operator()<CType>();
             }
         };
 
-        template <typename>
-        struct has_array_descriptor_helper;
-        template <typename... Parameters>
-        struct has_array_descriptor_helper<std::tuple<Parameters...>>
-            : disjunction<std::is_same<Parameters, gen_fortran_array_descriptor *>...>::type {};
-
-        template <typename CSignature>
-        struct has_array_descriptor
-            : has_array_descriptor_helper<typename function_traits::parameter_types<CSignature>::type> {};
-
-        /**
-         * @brief This function writes the `interface`-section of the fortran-code.
-         * @param strm Stream, where the output will be written to
-         * @param c_name The name of the function in the c-header
-         * @param fortran_name The name of the function in the c-bindings of the module.
-         */
-        template <class CSignature>
-        std::ostream &write_fortran_binding(std::ostream &strm, char const *c_name, char const *fortran_name) {
-            std::stringstream tmp_strm;
-            tmp_strm << fortran_return_type<typename function_traits::result_type<CSignature>::type>() << " "
-                     << fortran_name << "(";
-            for_each_param<CSignature>(ignore_type_f{}, [&](const std::string &, int i) {
-                if (i)
-                    tmp_strm << ", ";
-                tmp_strm << "arg" << i;
-            });
-            tmp_strm << ")";
-            if (strcmp(c_name, fortran_name) == 0)
-                tmp_strm << " bind(c)";
-            else
-                tmp_strm << " bind(c, name=\"" << c_name << "\")";
-            strm << wrap_line(tmp_strm.str(), "    ");
-            strm << "      use iso_c_binding\n";
-            if (has_array_descriptor<CSignature>::value)
-                strm << "      use gen_array_descriptor\n";
-            for_each_param<CSignature>(fortran_param_type_from_c_f{},
-                [&](const std::string &type_name, int i) { strm << "      " << type_name << " :: arg" << i << "\n"; });
-            return strm << "    end "
-                        << fortran_function_specifier<typename function_traits::result_type<CSignature>::type>() + "\n";
-        }
-
         struct cpp_type_descriptor_f {
             template <class CppType,
                 class CType = param_converted_to_c_t<CppType>,
                 typename std::enable_if<std::is_same<CType, gen_fortran_array_descriptor *>::value &&
-                                            is_fortran_array_wrappable<CppType>::value,
+                                            is_fortran_array_wrappable<CppType>::value &&
+                                            has_static_fortran_view_meta<CppType>::value,
+                    int>::type = 0>
+            gen_fortran_array_descriptor const *operator()() const {
+                return &static_fortran_view_descriptor<CppType>::value;
+            }
+            template <class CppType,
+                class CType = param_converted_to_c_t<CppType>,
+                typename std::enable_if<std::is_same<CType, gen_fortran_array_descriptor *>::value &&
+                                            is_fortran_array_wrappable<CppType>::value &&
+                                            !has_static_fortran_view_meta<CppType>::value,
                     int>::type = 0>
             gen_fortran_array_descriptor const *operator()() const {
                 static const gen_fortran_array_descriptor meta =
@@ -317,144 +387,224 @@ namespace cpp_bindgen {
                 return nullptr;
             }
         };
+
         /**
-         * @brief This function writes the `contains`-section of the fortran-code.
-         * @param strm Stream, where the output will be written to
-         * @param fortran_cbindings_name The name of the function in the c-bindings-part of the module.
-         * @param fortran_name The name of the function in the fortran-part of the module.
+         * The parts of the Fortran wrappers written for the modules with submodules (see generate_fortran_submodule()):
+         * the procedure is written as an interface body in the module and as a module procedure in a submodule.
          */
-        template <class CppSignature>
-        std::ostream &write_fortran_wrapper(
-            std::ostream &strm, char const *fortran_cbindings_name, const char *fortran_name) {
-            using CSignature = wrapped_t<CppSignature>;
-
-            std::stringstream tmp_strm;
-            tmp_strm << fortran_return_type<typename function_traits::result_type<CSignature>::type>() << " "
-                     << fortran_name << "(";
-            for_each_param<CSignature>(ignore_type_f{}, [&](const std::string &, int i) {
-                if (i)
-                    tmp_strm << ", ";
-                tmp_strm << "arg" << i;
-            });
-            tmp_strm << ")";
-            strm << wrap_line(tmp_strm.str(), "    ");
-
-            strm << "      use iso_c_binding\n";
-            if (has_array_descriptor<CSignature>::value) {
-                strm << "      use gen_array_descriptor\n";
-            }
-            for_each_param<CppSignature>(fortran_param_type_from_cpp_f{}, [&](const std::string &type_name, int i) {
-                strm << "      " << type_name << ", target :: arg" << i << "\n";
-            });
-
-            for_each_param<CppSignature>(cpp_type_descriptor_f{}, [&](gen_fortran_array_descriptor const *meta, int i) {
-                if (meta) {
-                    const auto desc_name = "descriptor" + std::to_string(i);
-                    strm << "      type(gen_fortran_array_descriptor) :: " + desc_name + "\n";
-                }
-            });
-            strm << "\n";
-
-            for_each_param<CppSignature>(cpp_type_descriptor_f{}, [&](gen_fortran_array_descriptor const *meta, int i) {
-                if (meta) {
-                    const auto var_name = "arg" + std::to_string(i);
-                    const auto desc_name = "descriptor" + std::to_string(i);
-                    std::string c_loc = "c_loc(" + var_name + "(";
-                    for (int i = 0; i < meta->rank; ++i) {
-                        if (i)
-                            c_loc += ",";
-                        c_loc += "lbound(" + var_name + ", " + std::to_string(i + 1) + ")";
-                    }
-                    c_loc += "))";
-                    if (meta->is_acc_present)
-                        strm << "      !$acc data present(" << var_name << ")\n" //
-                             << "      !$acc host_data use_device(" << var_name << ")\n";
-
-                    strm << "      " << desc_name << "%rank = " << meta->rank << "\n"                 //
-                         << "      " << desc_name << "%type = " << meta->type << "\n"                 //
-                         << "      " << desc_name << "%dims = reshape(shape(" << var_name << "), &\n" //
-                         << "        shape(" << desc_name << "%dims), (/0/))\n"                       //
-                         << "      " << desc_name << "%data = " << c_loc << "\n";
-                    if (meta->is_acc_present)
-                        strm << "      !$acc end host_data\n" //
-                             << "      !$acc end data\n";
-                    strm << "\n";
-                }
-            });
-
-            tmp_strm.str("");
-            if (std::is_void<typename function_traits::result_type<CSignature>::type>::value) {
-                tmp_strm << "call " << fortran_cbindings_name << "(";
-            } else {
-                tmp_strm << fortran_name << " = " << fortran_cbindings_name << "(";
-            }
-            for_each_param<CppSignature>(cpp_type_descriptor_f{}, [&](gen_fortran_array_descriptor const *meta, int i) {
-                if (i)
-                    tmp_strm << ", ";
-                if (meta) {
-                    const auto desc_name = "descriptor" + std::to_string(i);
-                    tmp_strm << desc_name;
-                } else {
-                    tmp_strm << "arg" << i;
-                }
-            });
-            tmp_strm << ")";
-            strm << wrap_line(tmp_strm.str(), "      ");
-
-            return strm << "    end "
-                        << fortran_function_specifier<typename function_traits::result_type<CSignature>::type>() + "\n";
+        enum class fortran_wrapper_part { procedure, interface_body, module_procedure };
+
+        /**
+         * A parameter or the result of a C signature as seen by the generator. The signatures of the bindings are
+         * constant data, see c_signature_info_of, the code writing them is shared by all bindings.
+         */
+        struct c_type_info {
+            void (*m_write_c_type)(std::ostream &);
+            /// The Fortran declaration of a dummy argument of this type, or of a function result (null for `void`).
+            std::string (*m_fortran_type)();
+            bool m_c_array;    // see is_c_array_param
+            bool m_nonnull;    // see is_nonnull_c_param
+            bool m_descriptor; // a gen_fortran_array_descriptor, the Fortran interface uses gen_array_descriptor
+        };
+
+        struct c_signature_info {
+            c_type_info m_result;
+            c_type_info const *m_params;
+            int m_arity;
+        };
+
+        template <class T>
+        std::string fortran_param_type_from_c() {
+            return fortran_param_type_from_c_f{}.template operator()<T>();
         }
 
-        struct c_bindings_traits {
-            template <class CSignature>
-            static void generate_entity(std::ostream &strm, char const *c_name) {
-                write_c_binding<CSignature>(strm, c_name);
-            }
+        template <class T>
+        constexpr c_type_info c_param_info() {
+            return {write_c_type<T>,
+                fortran_param_type_from_c<T>,
+                is_c_array_param<T>::value,
+                is_nonnull_c_param<T>::value,
+                std::is_same<T, gen_fortran_array_descriptor *>::value};
+        }
+
+        template <class T, enable_if_t<std::is_void<T>::value, int> = 0>
+        constexpr c_type_info c_result_info() {
+            return {write_c_type<T>, nullptr, false, false, false};
+        }
+
+        template <class T, enable_if_t<!std::is_void<T>::value, int> = 0>
+        constexpr c_type_info c_result_info() {
+            return {write_c_type<T>, fortran_type_name<T>, false, false, false};
+        }
+
+        template <class CSignature>
+        struct c_signature_info_of;
+
+        template <class R, class... Params>
+        struct c_signature_info_of<R(Params...)> {
+            static constexpr c_type_info params[sizeof...(Params) + 1] = {c_param_info<Params>()..., {}};
+            static constexpr c_signature_info value = {c_result_info<R>(), params, sizeof...(Params)};
+        };
+        template <class R, class... Params>
+        constexpr c_type_info c_signature_info_of<R(Params...)>::params[sizeof...(Params) + 1];
+        template <class R, class... Params>
+        constexpr c_signature_info c_signature_info_of<R(Params...)>::value;
+
+        /// A parameter of a Fortran wrapper: its declaration and, if it is passed as a descriptor, the meta data.
+        struct fortran_wrapper_param_info {
+            std::string (*m_type)(bool deferred);
+            gen_fortran_array_descriptor const *(*m_descriptor)();
+            /// The dims of the descriptor are the static extents of the array, the wrapper checks the shape.
+            bool m_static_extents;
         };
 
-        struct fortran_bindings_traits {
-            template <class CSignature>
-            static void generate_entity(std::ostream &strm, char const *c_name, char const *fortran_name) {
-                write_fortran_binding<CSignature>(strm, c_name, fortran_name);
-            }
+        template <class CppType>
+        std::string fortran_param_type_from_cpp(bool deferred) {
+            return fortran_param_type_from_cpp_f{}.template operator()<CppType>(deferred);
+        }
+
+        template <class CppType>
+        gen_fortran_array_descriptor const *cpp_type_descriptor() {
+            return cpp_type_descriptor_f{}.template operator()<CppType>();
+        }
+
+        template <class CppSignature>
+        struct fortran_wrapper_params_of;
+
+        template <class R, class... Params>
+        struct fortran_wrapper_params_of<R(Params...)> {
+            static constexpr fortran_wrapper_param_info value[sizeof...(Params) + 1] = {
+                {fortran_param_type_from_cpp<Params>,
+                    cpp_type_descriptor<Params>,
+                    has_static_fortran_extents<Params>::value}...,
+                {}};
         };
+        template <class R, class... Params>
+        constexpr fortran_wrapper_param_info fortran_wrapper_params_of<R(Params...)>::value[sizeof...(Params) + 1];
 
-        struct fortran_wrapper_traits {
-            template <class CppSignature>
-            static void generate_entity(
-                std::ostream &strm, char const *fortran_cbindings_name, const char *fortran_name) {
-                write_fortran_wrapper<CppSignature>(strm, fortran_cbindings_name, fortran_name);
-            }
+        /// The element kinds of the result and of the parameters of an elemental binding.
+        template <class CppSignature>
+        struct elemental_kinds_of;
+
+        template <class R, class... Params>
+        struct elemental_kinds_of<R(Params...)> {
+            static_assert(sizeof...(Params) > 0, "elemental bindings need parameters");
+            static constexpr gen_fortran_array_kind value[] = {
+                fortran_array_element_kind<R>::value, fortran_array_element_kind<decay_t<Params>>::value...};
         };
+        template <class R, class... Params>
+        constexpr gen_fortran_array_kind elemental_kinds_of<R(Params...)>::value[];
 
-        template <class Traits, class Signature, class... Params>
-        void add_entity(const char *name, Params &&... params) {
-            get_entities<Traits>().add(name,
-                std::bind(Traits::template generate_entity<Signature>,
-                    std::placeholders::_1,
-                    std::forward<Params>(params)...));
+        /// How a binding is written: asynchronous bindings carry a note, elemental ones get wrappers for each rank.
+        enum class declaration_kind { plain, async, elemental };
+
+        /**
+         * A binding for the generator: its names, its C signature and, if it is called through a Fortran wrapper,
+         * the parameters of the wrapper. Everything is constant data, see generate_c_interface().
+         */
+        struct declaration_record {
+            char const *m_c_name;
+            char const *m_fortran_cbindings_name;
+            char const *m_fortran_name;
+            declaration_kind m_kind;
+            /// The call may be executed after the generated function has returned: asynchronous bindings and the
+            /// `void` bindings of libraries with the QUEUE option.
+            bool m_deferred;
+            c_signature_info const *m_c_signature;
+            /// The parameters of the Fortran wrapper, null if the binding is called directly.
+            fortran_wrapper_param_info const *m_wrapper_params;
+            /// The element kinds of elemental bindings, see elemental_kinds_of.
+            gen_fortran_array_kind const *m_elemental_kinds;
+        };
+
+        template <class CSignature>
+        constexpr declaration_record simple_declaration(char const *name) {
+            return {name,
+                name,
+                name,
+                declaration_kind::plain,
+                false,
+                &c_signature_info_of<CSignature>::value,
+                nullptr,
+                nullptr};
+        }
+
+        /// True if the calls of the binding with the signature `CppSignature` are recorded, see wrap_queued().
+        template <class CppSignature>
+        constexpr bool is_queued_signature() {
+#ifdef CPP_BINDGEN_ENABLE_QUEUE
+            return std::is_void<typename function_traits::result_type<CppSignature>::type>::value;
+#else
+            return false;
+#endif
+        }
+
+        template <class CppSignature>
+        constexpr declaration_record wrapped_declaration(
+            char const *c_name, char const *fortran_cbindings_name, char const *fortran_name) {
+            return {c_name,
+                fortran_cbindings_name,
+                fortran_name,
+                declaration_kind::plain,
+                is_queued_signature<CppSignature>(),
+                &c_signature_info_of<wrapped_t<CppSignature>>::value,
+                fortran_wrapper_params_of<scratch_free_signature_t<CppSignature>>::value,
+                nullptr};
         }
 
         template <class CSignature>
-        struct registrar_simple {
-            registrar_simple(char const *name) {
-                add_entity<_impl::c_bindings_traits, CSignature>(name, name);
-                add_entity<_impl::fortran_bindings_traits, CSignature>(name, name, name);
-            }
-        };
+        constexpr declaration_record async_declaration(char const *name) {
+            return {name,
+                name,
+                name,
+                declaration_kind::async,
+                true,
+                &c_signature_info_of<CSignature>::value,
+                nullptr,
+                nullptr};
+        }
+
         template <class CppSignature>
-        struct registrar_wrapped {
-            registrar_wrapped(char const *c_name, char const *fortran_cbindings_name, char const *fortran_name) {
-                using CSignature = wrapped_t<CppSignature>;
-                add_entity<_impl::c_bindings_traits, CSignature>(c_name, c_name);
-                add_entity<_impl::fortran_bindings_traits, CSignature>(c_name, c_name, fortran_cbindings_name);
-                add_entity<_impl::fortran_wrapper_traits, CppSignature>(c_name, fortran_cbindings_name, fortran_name);
-            }
+        constexpr declaration_record async_wrapped_declaration(
+            char const *c_name, char const *fortran_cbindings_name, char const *fortran_name) {
+            return {c_name,
+                fortran_cbindings_name,
+                fortran_name,
+                declaration_kind::async,
+                true,
+                &c_signature_info_of<wrapped_t<CppSignature>>::value,
+                fortran_wrapper_params_of<scratch_free_signature_t<CppSignature>>::value,
+                nullptr};
+        }
+
+        template <class CppSignature>
+        constexpr declaration_record elemental_declaration(
+            char const *c_name, char const *fortran_cbindings_name, char const *fortran_name) {
+            return {c_name,
+                fortran_cbindings_name,
+                fortran_name,
+                declaration_kind::elemental,
+                false,
+                &c_signature_info_of<elemental_t<CppSignature>>::value,
+                nullptr,
+                elemental_kinds_of<CppSignature>::value};
+        }
+
+        /// Makes `m_concrete_name` a specific procedure of the Fortran generic interface `m_generic_name`.
+        struct generic_record {
+            char const *m_generic_name;
+            char const *m_concrete_name;
+            int m_order; // of the procedures of the same translation unit
         };
 
-        struct fortran_generic_registrar {
-            fortran_generic_registrar(char const *generic_name, char const *concrete_name);
+#ifndef __ELF__
+        /// Registers the records on load where linker sections are not available, see GEN_ADD_RECORD_IMPL.
+        struct record_registrar {
+            record_registrar(declaration_record const *record);
+            record_registrar(generic_record const *record);
+            record_registrar(c_attributes_record const *record);
         };
+#endif
     } // namespace _impl
 
     /// Outputs the content of the C compatible header with the declarations added by GEN_ADD_GENERATED_DECLARATION
@@ -462,18 +612,95 @@ namespace cpp_bindgen {
 
     /// Outputs the content of the Fortran module with the declarations added by GEN_ADD_GENERATED_DECLARATION
     void generate_fortran_interface(std::ostream &strm, std::string const &module_name);
+
+    /**
+     *  Outputs the content of the Fortran module with the declarations added by GEN_ADD_GENERATED_DECLARATION, the
+     *  bodies of its wrappers are left to `submodules` submodules written by generate_fortran_submodule(). Changing a
+     *  body does not change the module, hence the Fortran code using it is not recompiled, and the submodules can be
+     *  compiled in parallel.
+     */
+    void generate_fortran_interface(std::ostream &strm, std::string const &module_name, int submodules);
+
+    /**
+     *  Outputs the content of the submodule `index` (one based) of the `submodules` submodules of the Fortran module
+     *  `module_name`, see generate_fortran_interface(). The wrappers are distributed by a hash of their names, hence
+     *  adding a binding changes one submodule only.
+     */
+    void generate_fortran_submodule(std::ostream &strm, std::string const &module_name, int index, int submodules);
+
+    /// The file of the submodule `index` of the module in `fortran_file`: `_<index>` is added before the extension.
+    std::string fortran_submodule_file_name(std::string const &fortran_file, int index);
+
+    /**
+     *  Outputs a linker version script exporting the functions added by GEN_ADD_GENERATED_DECLARATION and hiding all
+     *  other symbols, for the shared libraries of the SHARED option of cpp_bindgen_add_library().
+     */
+    void generate_version_script(std::ostream &strm);
+
+    /**
+     *  Outputs the content of a C header with a table of pointers to the functions added by
+     *  GEN_ADD_GENERATED_DECLARATION, `struct <name>_dispatch`, and the loader filling it from a shared library at run
+     *  time, `int <name>_load(struct <name>_dispatch *, char const *path)`, see gen_dispatch_open(). The table starts
+     *  zero-initialized, loading it again unloads the library it held once the new one is complete.
+     */
+    void generate_c_dispatch(std::ostream &strm, std::string const &name);
+
+    /**
+     *  Outputs the content of the Fortran module `<module_name>_dispatch`: the module of generate_fortran_interface()
+     *  with procedure pointers in place of the C bindings, associated by `<module_name>_load(path)` with the functions
+     *  of a shared library loaded at run time.
+     */
+    void generate_fortran_dispatch(std::ostream &strm, std::string const &module_name);
+
+    /// The file of the dispatch table of the bindings in `file`: `_dispatch` is added before the extension.
+    std::string dispatch_file_name(std::string const &file);
 } // namespace cpp_bindgen
+#endif
+
+/**
+ *  Adds the constant record `var`, initialized with `...`, to the records of the type `record_t` walked by the
+ *  generator. On ELF platforms only a pointer to the record is placed into the linker section `section_name` (the
+ *  linker defines the symbols __start_<section_name> and __stop_<section_name> around it), hence loading a library
+ *  does not run any code for the records of its bindings. Without declarations nothing is added.
+ */
+#if !GEN_DECLARATIONS_IMPL
+#define GEN_ADD_RECORD_IMPL(record_t, section_name, var, ...) static_assert(true, "")
+#elif defined(__ELF__)
+#define GEN_ADD_RECORD_IMPL(record_t, section_name, var, ...)                     \
+    static const ::cpp_bindgen::_impl::record_t var = __VA_ARGS__;                \
+    __attribute__((section(#section_name), used, aligned(sizeof(void *)))) static \
+        ::cpp_bindgen::_impl::record_t const *var##_entry = &var
+#else
+#define GEN_ADD_RECORD_IMPL(record_t, section_name, var, ...)      \
+    static const ::cpp_bindgen::_impl::record_t var = __VA_ARGS__; \
+    static ::cpp_bindgen::_impl::record_registrar var##_entry(&var)
+#endif
+
+#define GEN_ADD_DECLARATION_RECORD_IMPL(name, ...) \
+    GEN_ADD_RECORD_IMPL(declaration_record, gen_declarations, generated_declaration_record_##name, __VA_ARGS__)
 
 /**
  *  Registers the function that for declaration generations.
  *  Users should not use these directly.
  */
 #define GEN_ADD_GENERATED_DECLARATION(csignature, name) \
-    static ::cpp_bindgen::_impl::registrar_simple<csignature> generated_declaration_registrar_##name(#name)
-#define GEN_ADD_GENERATED_DECLARATION_WRAPPED(cppsignature, name)                                        \
-    static ::cpp_bindgen::_impl::registrar_wrapped<cppsignature> generated_declaration_registrar_##name( \
-        #name, BOOST_PP_STRINGIZE(BOOST_PP_CAT(name, _impl)), #name)
-
-#define GEN_ADD_GENERIC_DECLARATION(generic_name, concrete_name)                                                       \
-    static ::cpp_bindgen::_impl::fortran_generic_registrar fortran_generic_registrar_##generic_name##_##concrete_name( \
-        #generic_name, #concrete_name)
+    GEN_ADD_DECLARATION_RECORD_IMPL(name, ::cpp_bindgen::_impl::simple_declaration<csignature>(#name))
+#define GEN_ADD_GENERATED_DECLARATION_WRAPPED(cppsignature, name) \
+    GEN_ADD_DECLARATION_RECORD_IMPL(                              \
+        name, ::cpp_bindgen::_impl::wrapped_declaration<cppsignature>(#name, #name "_impl", #name))
+
+#define GEN_ADD_GENERATED_ASYNC_DECLARATION(csignature, name) \
+    GEN_ADD_DECLARATION_RECORD_IMPL(name, ::cpp_bindgen::_impl::async_declaration<csignature>(#name))
+#define GEN_ADD_GENERATED_ASYNC_DECLARATION_WRAPPED(cppsignature, name) \
+    GEN_ADD_DECLARATION_RECORD_IMPL(                                    \
+        name, ::cpp_bindgen::_impl::async_wrapped_declaration<cppsignature>(#name, #name "_impl", #name))
+
+#define GEN_ADD_GENERATED_ELEMENTAL_DECLARATION(cppsignature, name) \
+    GEN_ADD_DECLARATION_RECORD_IMPL(                                \
+        name, ::cpp_bindgen::_impl::elemental_declaration<cppsignature>(#name, #name "_impl", #name))
+
+#define GEN_ADD_GENERIC_DECLARATION(generic_name, concrete_name) \
+    GEN_ADD_RECORD_IMPL(generic_record,                          \
+        gen_generics,                                            \
+        fortran_generic_record_##generic_name##_##concrete_name, \
+        ::cpp_bindgen::_impl::generic_record{#generic_name, #concrete_name, __COUNTER__})
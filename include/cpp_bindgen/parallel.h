@@ -0,0 +1,36 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *  Sets the number of threads executing the tiles of parallel bindings.
+ *
+ *  The default is taken from the environment variable GEN_PARALLEL_NUM_THREADS or, if it is not set, from the OpenMP
+ *  runtime (if the bindings runtime is built with OpenMP) or the number of hardware threads. Parallel bindings called
+ *  concurrently from several threads do not wait for each other, each call has its own team of threads.
+ */
+void gen_set_parallel_num_threads(int num_threads);
+
+/**
+ *  Sets the grain size of parallel bindings: the number of slices along the outermost dimension in one tile.
+ *
+ *  The default is taken from the environment variable GEN_PARALLEL_GRAIN_SIZE or is 1. The tiles are distributed
+ *  statically, each thread executes a contiguous range of tiles and, for arrays of the same shape, the same range in
+ *  every call.
+ */
+void gen_set_parallel_grain_size(int grain_size);
+
+#ifdef __cplusplus
+}
+#endif
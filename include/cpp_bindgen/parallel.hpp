@@ -0,0 +1,125 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+
+#include "common/disjunction.hpp"
+#include "common/make_indices.hpp"
+
+#include "array_descriptor.h"
+#include "function_wrapper.hpp"
+#include "parallel.h"
+#include "visit.hpp"
+
+namespace cpp_bindgen {
+
+    /**
+     * Calls `fun(begin, end)` for the tiles [begin, end) of [0, size) on the threads of the parallel bindings, see
+     * gen_set_parallel_grain_size(). The tiles are executed concurrently, the first exception thrown by `fun` is
+     * rethrown after all tiles have finished.
+     */
+    void parallel_for_tiles(int size, std::function<void(int, int)> const &fun);
+
+    namespace _impl {
+        template <std::size_t... Is>
+        std::size_t fortran_array_element_size(gen_fortran_array_kind kind, index_sequence<Is...>) {
+            static constexpr std::size_t sizes[] = {sizeof(typename fortran_kind_type<Is>::type)...};
+            return sizes[kind];
+        }
+
+        inline std::size_t fortran_array_element_size(gen_fortran_array_kind kind) {
+            return fortran_array_element_size(kind, make_index_sequence<visit_num_kinds>{});
+        }
+
+        /// Restricts the contiguous array `descriptor` to the slices [begin, end) of its outermost dimension.
+        inline gen_fortran_array_descriptor outer_tile(
+            gen_fortran_array_descriptor const &descriptor, int begin, int end) {
+            gen_fortran_array_descriptor res = descriptor;
+            std::size_t slice = fortran_array_element_size(descriptor.type);
+            for (int i = 0; i < descriptor.rank - 1; ++i)
+                slice *= descriptor.dims[i];
+            res.dims[descriptor.rank - 1] = end - begin;
+            res.data = static_cast<char *>(descriptor.data) + begin * slice;
+            return res;
+        }
+
+        template <class T>
+        void update_outer_extent(T const &, int &) {}
+
+        inline void update_outer_extent(gen_fortran_array_descriptor *descriptor, int &extent) {
+            if (descriptor->rank < 1)
+                throw std::runtime_error("The arrays of parallel bindings need a rank of at least 1");
+            int res = descriptor->dims[descriptor->rank - 1];
+            if (extent >= 0 && extent != res)
+                throw std::runtime_error("Outermost extents do not match: " + std::to_string(extent) +
+                                         " != " + std::to_string(res));
+            extent = res;
+        }
+
+        /// The argument passed for one tile: descriptors are restricted to the tile, other arguments are passed as is.
+        template <class T>
+        struct tile_arg {
+            T m_arg;
+            tile_arg(T arg, int, int) : m_arg(arg) {}
+            T get() const { return m_arg; }
+        };
+
+        template <>
+        struct tile_arg<gen_fortran_array_descriptor *> {
+            gen_fortran_array_descriptor m_tile;
+            tile_arg(gen_fortran_array_descriptor *descriptor, int begin, int end)
+                : m_tile(outer_tile(*descriptor, begin, end)) {}
+            gen_fortran_array_descriptor *get() { return &m_tile; }
+        };
+
+        template <class T, class Impl>
+        struct parallel_f;
+
+        template <class R, class... Params, class Impl>
+        struct parallel_f<R(Params...), Impl> {
+            static_assert(std::is_void<R>::value, "parallel bindings must return void");
+            static_assert(
+                disjunction<std::is_same<param_converted_to_c_t<Params>, gen_fortran_array_descriptor *>...>::value,
+                "parallel bindings need at least one array parameter");
+
+            Impl m_fun;
+
+            void operator()(param_converted_to_c_t<Params>... args) const {
+                int extent = -1;
+                (void)(int[]){0, (update_outer_extent(args, extent), 0)...};
+                auto wrapped = wrap<void(Params...)>(std::cref(m_fun));
+                parallel_for_tiles(extent, [&](int begin, int end) {
+                    wrapped(tile_arg<param_converted_to_c_t<Params>>(args, begin, end).get()...);
+                });
+            }
+        };
+    } // namespace _impl
+
+    /**
+     * Wrap the functor of type `Impl`, written for a block of the arrays passed to it, to a functor with the
+     * `wrapped_t<T>` signature that splits the arrays along their outermost dimension into tiles and calls `Impl` for
+     * every tile in parallel, see parallel_for_tiles().
+     */
+    template <class T, class Impl>
+    constexpr _impl::parallel_f<scratch_free_signature_t<T>, _impl::scratch_injected_t<T, decay_t<Impl>>>
+    wrap_parallel(Impl &&obj) {
+        return {_impl::inject_scratch<T>(std::forward<Impl>(obj))};
+    }
+
+    /// Specialization for function pointers.
+    template <class T>
+    constexpr _impl::parallel_f<scratch_free_signature_t<T>, _impl::scratch_injected_t<T, T *>> wrap_parallel(T *obj) {
+        return {_impl::inject_scratch<T>(obj)};
+    }
+} // namespace cpp_bindgen
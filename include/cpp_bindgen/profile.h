@@ -0,0 +1,30 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *  Prints the call counters and timings of all bindings to the standard output.
+ *
+ *  Only the bindings of libraries built with the PROFILE option of cpp_bindgen_add_library() are instrumented. The
+ *  table contains one row per binding, accumulated over all threads; the time spent in the implementation and the time
+ *  spent converting the arguments and the result are listed separately.
+ */
+void gen_profile_report(void);
+
+/// Resets all counters. No instrumented binding may be running concurrently.
+void gen_profile_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
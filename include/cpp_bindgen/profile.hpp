@@ -0,0 +1,154 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "common/make_indices.hpp"
+
+#include "function_wrapper.hpp"
+#include "profile.h"
+
+namespace cpp_bindgen {
+
+    /**
+     *   The counters of one binding on one thread.
+     *
+     *   They are only written by the owning thread, hence the updates need no read-modify-write operations; the
+     *   atomics make it safe to read them from gen_profile_report() at any time. Times are in nanoseconds.
+     */
+    struct profile_counters {
+        std::atomic<std::uint64_t> m_calls{0};
+        std::atomic<std::uint64_t> m_total{0};
+        std::atomic<std::uint64_t> m_min{std::numeric_limits<std::uint64_t>::max()};
+        std::atomic<std::uint64_t> m_max{0};
+        std::atomic<std::uint64_t> m_conversion{0};
+        std::atomic<std::uint64_t> m_impl{0};
+    };
+
+    struct profile_slot;
+
+    /**
+     *   The counters of the binding `name` for the calling thread, held by a thread_local in the generated function.
+     *
+     *   On destruction, i.e. when the thread exits, the counters are added to the totals of the binding and their slot
+     *   is reused by the next thread, hence the memory does not grow with the number of threads ever started.
+     */
+    class profile_thread_counters {
+        profile_slot *m_slot;
+        profile_counters *m_counters;
+
+      public:
+        explicit profile_thread_counters(char const *name);
+        ~profile_thread_counters();
+
+        profile_thread_counters(profile_thread_counters const &) = delete;
+        profile_thread_counters &operator=(profile_thread_counters const &) = delete;
+
+        profile_counters &get() const { return *m_counters; }
+    };
+
+    /// Writes the table printed by gen_profile_report() to `strm`.
+    void profile_report(std::ostream &strm);
+
+    namespace _impl {
+        using profile_clock = std::chrono::steady_clock;
+
+        inline std::uint64_t profile_duration(profile_clock::time_point from, profile_clock::time_point to) {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(to - from).count();
+        }
+
+        inline void profile_add(std::atomic<std::uint64_t> &counter, std::uint64_t value) {
+            counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+
+        inline void profile_record(profile_counters &counters,
+            profile_clock::time_point start,
+            profile_clock::time_point converted,
+            profile_clock::time_point invoked,
+            profile_clock::time_point finish) {
+            auto total = profile_duration(start, finish);
+            profile_add(counters.m_calls, 1);
+            profile_add(counters.m_total, total);
+            profile_add(counters.m_conversion, profile_duration(start, converted) + profile_duration(invoked, finish));
+            profile_add(counters.m_impl, profile_duration(converted, invoked));
+            if (total < counters.m_min.load(std::memory_order_relaxed))
+                counters.m_min.store(total, std::memory_order_relaxed);
+            if (total > counters.m_max.load(std::memory_order_relaxed))
+                counters.m_max.store(total, std::memory_order_relaxed);
+        }
+
+        template <class T, class Impl>
+        struct profiled_f;
+
+        template <class R, class... Params, class Impl>
+        struct profiled_f<R(Params...), Impl> {
+            Impl m_fun;
+            profile_counters &m_counters;
+
+            template <std::size_t... Is>
+            result_converted_to_c_t<R> invoke(index_sequence<Is...>, param_converted_to_c_t<Params>... args) const {
+                auto start = profile_clock::now();
+                std::tuple<Params...> params(convert_from_c<Params>(args)...);
+                auto converted = profile_clock::now();
+                R &&res = m_fun(std::forward<Params>(std::get<Is>(params))...);
+                auto invoked = profile_clock::now();
+                auto c_res = convert_to_c(std::forward<R>(res));
+                profile_record(m_counters, start, converted, invoked, profile_clock::now());
+                return c_res;
+            }
+
+            result_converted_to_c_t<R> operator()(param_converted_to_c_t<Params>... args) const {
+                return invoke(make_index_sequence<sizeof...(Params)>{}, args...);
+            }
+        };
+
+        template <class... Params, class Impl>
+        struct profiled_f<void(Params...), Impl> {
+            Impl m_fun;
+            profile_counters &m_counters;
+
+            template <std::size_t... Is>
+            void invoke(index_sequence<Is...>, param_converted_to_c_t<Params>... args) const {
+                auto start = profile_clock::now();
+                std::tuple<Params...> params(convert_from_c<Params>(args)...);
+                auto converted = profile_clock::now();
+                m_fun(std::forward<Params>(std::get<Is>(params))...);
+                auto invoked = profile_clock::now();
+                profile_record(m_counters, start, converted, invoked, invoked);
+            }
+
+            void operator()(param_converted_to_c_t<Params>... args) const {
+                invoke(make_index_sequence<sizeof...(Params)>{}, args...);
+            }
+        };
+    } // namespace _impl
+
+    /// Wrap the functor of type `Impl` like `wrap<T>` does, and record the calls in `counters`.
+    template <class T, class Impl>
+    constexpr _impl::profiled_f<scratch_free_signature_t<T>, _impl::scratch_injected_t<T, decay_t<Impl>>>
+    wrap_profiled(profile_counters &counters, Impl &&obj) {
+        return {_impl::inject_scratch<T>(std::forward<Impl>(obj)), counters};
+    }
+
+    /// Specialization for function pointers.
+    template <class T>
+    constexpr _impl::profiled_f<scratch_free_signature_t<T>, _impl::scratch_injected_t<T, T *>>
+    wrap_profiled(profile_counters &counters, T *obj) {
+        return {_impl::inject_scratch<T>(obj), counters};
+    }
+} // namespace cpp_bindgen
@@ -0,0 +1,46 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *  Starts recording the calls of the calling thread into the command queue.
+ *
+ *  Only the bindings of libraries built with the QUEUE option of cpp_bindgen_add_library() are recorded, and only if
+ *  they return `void`: instead of being executed, their arguments are converted and stored together with the call.
+ *  Any other binding of such a library flushes the queue before it is executed, so that the order of the calls is
+ *  preserved. The bindings of libraries built without QUEUE neither are recorded nor flush the queue: they are executed
+ *  immediately, call gen_queue_flush() before them if they depend on recorded calls. Arrays, pointers and handles
+ *  passed to recorded calls must stay valid until the queue is flushed. The Fortran wrappers of the `void` bindings
+ *  take the arrays without copying them: a non-contiguous array stops the program.
+ */
+void gen_queue_begin(void);
+
+/// Stops recording and executes the recorded calls in order. Exceptions are rethrown, the rest of the queue is dropped.
+void gen_queue_flush(void);
+
+/**
+ *  The flavour of gen_queue_flush() that executes independent calls concurrently on the worker pool of the
+ *  asynchronous bindings (see async.h).
+ *
+ *  Two calls are independent if neither of them writes to memory that the other one accesses. Arrays cover the bytes of
+ *  all their elements, so overlapping sections of one array are dependent, and references to scalars cover the scalar.
+ *  Arguments that are passed to const qualified parameters are considered to be read, all other arrays and references
+ *  are considered to be written. Raw pointers of unknown length and handles may refer to any memory, a call taking one
+ *  of them depends on all other calls. Use it only if the recorded bindings have no other side effects.
+ */
+void gen_queue_flush_parallel(void);
+
+#ifdef __cplusplus
+}
+#endif
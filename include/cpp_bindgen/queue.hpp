@@ -0,0 +1,123 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "common/type_traits.hpp"
+
+#include "async.hpp"
+#include "function_wrapper.hpp"
+#include "queue.h"
+
+namespace cpp_bindgen {
+
+    /// The bytes `[m_begin, m_end)` accessed by a recorded call. Unbounded accesses may touch any memory.
+    struct queue_access {
+        char const *m_begin;
+        char const *m_end;
+        bool m_bounded;
+        bool m_write;
+    };
+
+    /// A recorded call together with the memory locations it accesses.
+    struct queue_command {
+        std::function<void()> m_fun;
+        std::vector<queue_access> m_accesses;
+    };
+
+    /// Returns true if the calling thread is recording calls, see gen_queue_begin().
+    bool queue_is_recording();
+
+    /// Appends a command to the queue of the calling thread.
+    void queue_record(queue_command command);
+
+    /// Executes the calls recorded so far by the calling thread (if any) without stopping the recording.
+    void queue_sync();
+
+    /// The access to the whole array described by `descriptor`.
+    queue_access make_queue_access(gen_fortran_array_descriptor const &descriptor, bool write);
+
+    namespace _impl {
+        template <class T>
+        struct is_queue_write_param
+            : bool_constant<(std::is_reference<T>::value || std::is_pointer<T>::value ||
+                                is_fortran_array_bindable<T>::value) &&
+                            !std::is_const<remove_pointer_t<remove_reference_t<T>>>::value> {};
+
+        template <class T, class Arg, enable_if_t<std::is_arithmetic<Arg>::value, int> = 0>
+        void add_queue_access(std::vector<queue_access> &, Arg) {}
+
+        // a reference refers to a single element, the extent of the array behind a raw pointer is unknown
+        template <class T, class Arg, enable_if_t<std::is_arithmetic<Arg>::value, int> = 0>
+        void add_queue_access(std::vector<queue_access> &accesses, Arg *arg) {
+            auto begin = reinterpret_cast<char const *>(arg);
+            accesses.push_back(
+                {begin, begin + sizeof(Arg), std::is_reference<T>::value, is_queue_write_param<T>::value});
+        }
+
+        // the object behind a handle may share its state with anything
+        template <class T>
+        void add_queue_access(std::vector<queue_access> &accesses, gen_handle *) {
+            accesses.push_back({nullptr, nullptr, false, is_queue_write_param<T>::value});
+        }
+
+        template <class T>
+        void add_queue_access(std::vector<queue_access> &accesses, gen_fortran_array_descriptor *arg) {
+            accesses.push_back(make_queue_access(*arg, is_queue_write_param<T>::value));
+        }
+
+        template <class T, class Impl>
+        struct queued_f;
+
+        template <class R, class... Params, class Impl>
+        struct queued_f<R(Params...), Impl> {
+            Impl m_fun;
+
+            result_converted_to_c_t<R> operator()(param_converted_to_c_t<Params>... args) const {
+                queue_sync();
+                return wrapped_f<R(Params...), Impl>{m_fun}(args...);
+            }
+        };
+
+        template <class... Params, class Impl>
+        struct queued_f<void(Params...), Impl> {
+            Impl m_fun;
+
+            void operator()(param_converted_to_c_t<Params>... args) const {
+                if (!queue_is_recording())
+                    return wrapped_f<void(Params...), Impl>{m_fun}(args...);
+                queue_command command;
+                (void)(int[]){0, (add_queue_access<Params>(command.m_accesses, args), 0)...};
+                auto call = make_async_call<void, Params...>(m_fun, args...);
+                command.m_fun = [call]() mutable { call(); };
+                queue_record(std::move(command));
+            }
+        };
+    } // namespace _impl
+
+    /// Wrap the functor of type `Impl` like `wrap<T>` does, but record the calls of `void` functions if the calling
+    /// thread is recording (see gen_queue_begin()).
+    template <class T, class Impl>
+    constexpr _impl::queued_f<scratch_free_signature_t<T>, _impl::scratch_injected_t<T, decay_t<Impl>>>
+    wrap_queued(Impl &&obj) {
+        return {_impl::inject_scratch<T>(std::forward<Impl>(obj))};
+    }
+
+    /// Specialization for function pointers.
+    template <class T>
+    constexpr _impl::queued_f<scratch_free_signature_t<T>, _impl::scratch_injected_t<T, T *>> wrap_queued(T *obj) {
+        return {_impl::inject_scratch<T>(obj)};
+    }
+} // namespace cpp_bindgen
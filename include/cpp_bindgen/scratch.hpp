@@ -0,0 +1,100 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace cpp_bindgen {
+    /**
+     * A bump allocator for the temporary buffers of bindings. The memory is allocated from blocks that are kept when
+     * the allocations are released, hence an arena that is reused for many calls stops allocating after the first
+     * ones.
+     *
+     * Bindings get the arena of the calling thread by declaring a `scratch &` parameter, see scratch_free_signature_t.
+     * Everything allocated during such a call is released when the call returns.
+     */
+    class scratch {
+      public:
+        /// The position of the arena, allocations made after mark() are released by release().
+        struct marker {
+            std::size_t m_block;
+            char *m_cur;
+        };
+
+      private:
+        struct block {
+            std::unique_ptr<char[]> m_data;
+            std::size_t m_size;
+        };
+
+        std::vector<block> m_blocks;
+        std::size_t m_block = 0;
+        char *m_cur = nullptr;
+        char *m_end = nullptr;
+
+        void *allocate_slow(std::size_t size, std::size_t alignment);
+        void release_slow(marker pos);
+
+      public:
+        scratch() = default;
+        scratch(scratch const &) = delete;
+        scratch &operator=(scratch const &) = delete;
+
+        /// Returns `size` bytes aligned to `alignment`, which must be a power of two.
+        void *allocate_bytes(std::size_t size, std::size_t alignment = alignof(std::max_align_t)) {
+            std::uintptr_t cur = reinterpret_cast<std::uintptr_t>(m_cur);
+            std::uintptr_t aligned = (cur + alignment - 1) & ~std::uintptr_t(alignment - 1);
+            if (m_cur && aligned - cur + size <= std::size_t(m_end - m_cur)) {
+                m_cur += aligned - cur + size;
+                return reinterpret_cast<void *>(aligned);
+            }
+            return allocate_slow(size, alignment);
+        }
+
+        /// Returns uninitialized storage for `n` objects of type `T`, they are never destructed.
+        template <class T>
+        T *allocate(std::size_t n) {
+            static_assert(std::is_trivially_destructible<T>::value, "scratch memory is released without destruction");
+            return static_cast<T *>(allocate_bytes(n * sizeof(T), alignof(T)));
+        }
+
+        marker mark() const { return {m_block, m_cur}; }
+
+        /// Releases the allocations made after `pos` was taken, the memory is kept for later allocations.
+        void release(marker pos) {
+            if (pos.m_cur && pos.m_block == m_block)
+                m_cur = pos.m_cur;
+            else
+                release_slow(pos);
+        }
+
+        /// The number of bytes in the blocks owned by the arena.
+        std::size_t capacity() const;
+    };
+
+    /// The arena of the calling thread.
+    scratch &thread_scratch();
+
+    /// Releases the allocations made in `arena` during the lifetime of the scope.
+    class scratch_scope {
+        scratch &m_arena;
+        scratch::marker m_marker;
+
+      public:
+        explicit scratch_scope(scratch &arena) : m_arena(arena), m_marker(arena.mark()) {}
+        scratch_scope(scratch_scope const &) = delete;
+        scratch_scope &operator=(scratch_scope const &) = delete;
+        ~scratch_scope() { m_arena.release(m_marker); }
+    };
+} // namespace cpp_bindgen
@@ -0,0 +1,36 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *  Opens a named range on the timeline of the calling thread; it is closed by the next gen_trace_end().
+ *
+ *  The bindings of libraries built with the TRACE option of cpp_bindgen_add_library() open and close a range named
+ *  after the exported function around each call. The closed ranges are kept in a ring buffer per thread (its capacity
+ *  is taken from the environment variable GEN_TRACE_BUFFER_SIZE, default 65536 ranges, older ranges are overwritten)
+ *  and written as complete events in the Chrome trace format to the file named by GEN_TRACE_FILE (default:
+ *  gen_trace.json) by gen_trace_flush() and at the exit of the program (by an atexit() handler, the ranges closed
+ *  later are dropped). The file can be opened with chrome://tracing or Perfetto.
+ */
+void gen_trace_begin(char const *name);
+
+/// Closes the innermost range opened by gen_trace_begin() on the calling thread.
+void gen_trace_end(void);
+
+/// Appends the ranges buffered by all threads to the trace file. The ranges that are still open are written later.
+void gen_trace_flush(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,27 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include "trace.h"
+
+namespace cpp_bindgen {
+
+    /// Like gen_trace_begin(), but `name` is not copied: it has to stay valid until the end of the program.
+    void trace_begin_static(char const *name);
+
+    /// The range covering the lifetime of the object.
+    class trace_scope {
+      public:
+        explicit trace_scope(char const *name) { trace_begin_static(name); }
+        ~trace_scope() { gen_trace_end(); }
+        trace_scope(trace_scope const &) = delete;
+        trace_scope &operator=(trace_scope const &) = delete;
+    };
+} // namespace cpp_bindgen
@@ -0,0 +1,153 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "common/make_indices.hpp"
+#include "common/type_traits.hpp"
+
+#include "array_descriptor.h"
+#include "fortran_array_view.hpp"
+
+namespace cpp_bindgen {
+    /**
+     * A contiguous Fortran array of element type `T` and rank `Rank`: the extents are in Fortran order and the
+     * multi-index operator is column-major, like the indexing in Fortran (but zero based).
+     *
+     * It is constructible from a gen_fortran_array_descriptor (checking element type and rank) and defines the
+     * gen_view_* member types, hence it is fortran_array_wrappable.
+     */
+    template <class T, int Rank>
+    class descriptor_view {
+        static_assert(Rank > 0 && Rank <= 7, "the rank of Fortran arrays is between 1 and 7");
+
+        T *m_data;
+        int m_dims[Rank];
+
+      public:
+        using gen_view_element_type = T;
+        using gen_view_rank = std::integral_constant<int, Rank>;
+        using gen_is_acc_present = std::false_type;
+
+        descriptor_view(gen_fortran_array_descriptor const &descriptor) : m_data(static_cast<T *>(descriptor.data)) {
+            if (descriptor.type != fortran_array_element_kind<T>::value)
+                throw std::runtime_error("Types do not match: fortran-type (" + std::to_string(descriptor.type) +
+                                         ") != c-type (" + std::to_string(fortran_array_element_kind<T>::value) +
+                                         ")");
+            if (descriptor.rank != Rank)
+                throw std::runtime_error("Rank does not match: fortran-rank (" + std::to_string(descriptor.rank) +
+                                         ") != c-rank (" + std::to_string(Rank) + ")");
+            for (int i = 0; i < Rank; ++i)
+                m_dims[i] = descriptor.dims[i];
+        }
+
+        T *data() const { return m_data; }
+        int extent(int i) const { return m_dims[i]; }
+
+        std::size_t size() const {
+            std::size_t res = 1;
+            for (int i = 0; i < Rank; ++i)
+                res *= m_dims[i];
+            return res;
+        }
+
+        T &operator[](std::size_t i) const { return m_data[i]; }
+
+        template <class... Is>
+        T &operator()(Is... is) const {
+            static_assert(sizeof...(Is) == Rank, "the number of indices does not match the rank");
+            std::size_t indices[] = {std::size_t(is)...};
+            std::size_t offset = 0;
+            for (int i = Rank - 1; i >= 0; --i)
+                offset = offset * m_dims[i] + indices[i];
+            return m_data[offset];
+        }
+    };
+
+    namespace _impl {
+        template <int Kind>
+        struct fortran_kind_type;
+        template <>
+        struct fortran_kind_type<gen_fk_Bool> {
+            using type = bool;
+        };
+        template <>
+        struct fortran_kind_type<gen_fk_Int> {
+            using type = int;
+        };
+        template <>
+        struct fortran_kind_type<gen_fk_Short> {
+            using type = short;
+        };
+        template <>
+        struct fortran_kind_type<gen_fk_Long> {
+            using type = long;
+        };
+        template <>
+        struct fortran_kind_type<gen_fk_LongLong> {
+            using type = long long;
+        };
+        template <>
+        struct fortran_kind_type<gen_fk_Float> {
+            using type = float;
+        };
+        template <>
+        struct fortran_kind_type<gen_fk_Double> {
+            using type = double;
+        };
+        template <>
+        struct fortran_kind_type<gen_fk_LongDouble> {
+            using type = long double;
+        };
+        template <>
+        struct fortran_kind_type<gen_fk_SignedChar> {
+            using type = signed char;
+        };
+
+        constexpr int visit_num_kinds = gen_fk_SignedChar + 1;
+        constexpr int visit_max_rank = 7;
+
+        template <class F>
+        using visit_result_t = decltype(std::declval<F &>()(std::declval<descriptor_view<double, 1>>()));
+
+        template <class F, std::size_t I>
+        visit_result_t<F> visit_entry(gen_fortran_array_descriptor const &descriptor, F &f) {
+            using element_t = typename fortran_kind_type<int(I) / visit_max_rank>::type;
+            return f(descriptor_view<element_t, int(I) % visit_max_rank + 1>(descriptor));
+        }
+
+        template <class F, std::size_t... Is>
+        visit_result_t<F> visit(gen_fortran_array_descriptor const &descriptor, F &f, index_sequence<Is...>) {
+            using entry_t = visit_result_t<F> (*)(gen_fortran_array_descriptor const &, F &);
+            static constexpr entry_t table[] = {&visit_entry<F, Is>...};
+            if (descriptor.type < 0 || descriptor.type >= visit_num_kinds)
+                throw std::runtime_error("Unsupported fortran-type (" + std::to_string(descriptor.type) + ")");
+            if (descriptor.rank < 1 || descriptor.rank > visit_max_rank)
+                throw std::runtime_error("Unsupported fortran-rank (" + std::to_string(descriptor.rank) + ")");
+            return table[descriptor.type * visit_max_rank + descriptor.rank - 1](descriptor, f);
+        }
+    } // namespace _impl
+
+    /**
+     * Calls `f` with the descriptor_view<T, Rank> of `descriptor`, where `T` and `Rank` are the element type and the
+     * rank of the described array. `f` is instantiated for every element type and every rank from 1 to 7, the
+     * specialization is selected by a single lookup in a table of function pointers. All instantiations must return
+     * the same type.
+     */
+    template <class F>
+    _impl::visit_result_t<F> visit(gen_fortran_array_descriptor const &descriptor, F &&f) {
+        return _impl::visit(descriptor, f, make_index_sequence<_impl::visit_num_kinds * _impl::visit_max_rank>{});
+    }
+} // namespace cpp_bindgen
@@ -0,0 +1,125 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <cpp_bindgen/async.h>
+#include <cpp_bindgen/async.hpp>
+
+namespace cpp_bindgen {
+    namespace {
+        class thread_pool {
+            std::mutex m_mutex;
+            std::condition_variable m_cv;
+            std::deque<std::function<void()>> m_tasks;
+            std::vector<std::thread> m_workers;
+            bool m_stop = false;
+
+            void work() {
+                while (true) {
+                    std::function<void()> task;
+                    {
+                        std::unique_lock<std::mutex> lock(m_mutex);
+                        m_cv.wait(lock, [this] { return m_stop || !m_tasks.empty(); });
+                        if (m_tasks.empty())
+                            return;
+                        task = std::move(m_tasks.front());
+                        m_tasks.pop_front();
+                    }
+                    task();
+                }
+            }
+
+          public:
+            explicit thread_pool(int num_threads) {
+                for (int i = 0; i < num_threads; ++i)
+                    m_workers.emplace_back(&thread_pool::work, this);
+            }
+
+            // the queued tasks are finished before the workers are joined
+            ~thread_pool() {
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_stop = true;
+                }
+                m_cv.notify_all();
+                for (auto &worker : m_workers)
+                    worker.join();
+            }
+
+            void execute(std::function<void()> task) {
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_tasks.push_back(std::move(task));
+                }
+                m_cv.notify_one();
+            }
+        };
+
+        int default_num_threads() {
+            if (char const *env = std::getenv("GEN_ASYNC_NUM_THREADS")) {
+                int res = std::atoi(env);
+                if (res > 0)
+                    return res;
+            }
+            int res = std::thread::hardware_concurrency();
+            return res > 0 ? res : 1;
+        }
+
+        struct async_pool {
+            std::mutex m_mutex;
+            std::unique_ptr<thread_pool> m_pool;
+        };
+
+        async_pool &get_async_pool() {
+            static async_pool obj;
+            return obj;
+        }
+
+        async_future &get_future(gen_handle *future) { return any_cast<async_future &>(future->m_value); }
+    } // namespace
+
+    void async_execute(std::function<void()> task) {
+        auto &obj = get_async_pool();
+        std::lock_guard<std::mutex> lock(obj.m_mutex);
+        if (!obj.m_pool)
+            obj.m_pool.reset(new thread_pool(default_num_threads()));
+        obj.m_pool->execute(std::move(task));
+    }
+} // namespace cpp_bindgen
+
+gen_handle *gen_wait(gen_handle *future) {
+    cpp_bindgen::any_moveable res = cpp_bindgen::get_future(future).get();
+    return res.has_value() ? new gen_handle{std::move(res)} : nullptr;
+}
+
+bool gen_test(gen_handle *future) {
+    auto &obj = cpp_bindgen::get_future(future);
+    // the future is no longer valid once it has been waited for
+    return !obj.valid() || obj.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+void gen_set_async_num_threads(int num_threads) {
+    auto &obj = cpp_bindgen::get_async_pool();
+    std::unique_ptr<cpp_bindgen::thread_pool> previous;
+    {
+        std::lock_guard<std::mutex> lock(obj.m_mutex);
+        previous = std::move(obj.m_pool);
+        obj.m_pool.reset(new cpp_bindgen::thread_pool(num_threads > 0 ? num_threads : 1));
+    }
+    // previous finishes its queued calls here, without blocking new submissions
+}
@@ -0,0 +1,25 @@
+! GridTools
+!
+! Copyright (c) 2014-2019, ETH Zurich
+! All rights reserved.
+!
+! Please, refer to the LICENSE file in the root directory.
+! SPDX-License-Identifier: BSD-3-Clause
+
+module gen_async
+    implicit none
+    interface
+        type(c_ptr) function gen_wait(future) bind(c)
+            use iso_c_binding
+            type(c_ptr), value :: future
+        end
+        logical(c_bool) function gen_test(future) bind(c)
+            use iso_c_binding
+            type(c_ptr), value :: future
+        end
+        subroutine gen_set_async_num_threads(num_threads) bind(c)
+            use iso_c_binding
+            integer(c_int), value :: num_threads
+        end
+    end interface
+end
@@ -0,0 +1,21 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cpp_bindgen/bound_array.h>
+#include <cpp_bindgen/bound_array.hpp>
+#include <cpp_bindgen/handle_impl.hpp>
+
+gen_handle *gen_bind_array(gen_fortran_array_descriptor *descriptor) {
+    return new gen_handle{cpp_bindgen::bound_array_storage(*descriptor)};
+}
+
+void gen_rebind_array(gen_handle *bound, gen_fortran_array_descriptor *descriptor) {
+    cpp_bindgen::any_cast<cpp_bindgen::bound_array_storage &>(bound->m_value).rebind(*descriptor);
+}
@@ -0,0 +1,170 @@
+! GridTools
+!
+! Copyright (c) 2014-2019, ETH Zurich
+! All rights reserved.
+!
+! Please, refer to the LICENSE file in the root directory.
+! SPDX-License-Identifier: BSD-3-Clause
+
+! gen_bind_array(arr) and gen_rebind_array(bound, arr), see bound_array.h, for integer(c_int), real(c_float) and
+! real(c_double) arrays of rank 1 to 3. The handle refers to the array itself, as a copy-in temporary would be gone after
+! the call: the arrays are not `contiguous` dummies, a non-contiguous array stops the program.
+module gen_bound_array
+    use iso_c_binding
+    use gen_array_descriptor
+    implicit none
+    private
+    public :: gen_bind_array, gen_rebind_array
+
+    interface
+        type(c_ptr) function gen_bind_array_impl(descriptor) bind(c, name="gen_bind_array")
+            use iso_c_binding
+            use gen_array_descriptor
+            type(gen_fortran_array_descriptor) :: descriptor
+        end
+        subroutine gen_rebind_array_impl(bound, descriptor) bind(c, name="gen_rebind_array")
+            use iso_c_binding
+            use gen_array_descriptor
+            type(c_ptr), value :: bound
+            type(gen_fortran_array_descriptor) :: descriptor
+        end
+    end interface
+
+    interface gen_bind_array
+        procedure gen_bind_array_int1, gen_bind_array_int2, gen_bind_array_int3, &
+            gen_bind_array_float1, gen_bind_array_float2, gen_bind_array_float3, &
+            gen_bind_array_double1, gen_bind_array_double2, gen_bind_array_double3
+    end interface
+
+    interface gen_rebind_array
+        procedure gen_rebind_array_int1, gen_rebind_array_int2, gen_rebind_array_int3, &
+            gen_rebind_array_float1, gen_rebind_array_float2, gen_rebind_array_float3, &
+            gen_rebind_array_double1, gen_rebind_array_double2, gen_rebind_array_double3
+    end interface
+
+contains
+    type(gen_fortran_array_descriptor) function make_descriptor(type, dims, data)
+        integer, intent(in) :: type
+        integer, dimension(:), intent(in) :: dims
+        type(c_ptr), intent(in) :: data
+
+        make_descriptor%type = type
+        make_descriptor%rank = size(dims)
+        make_descriptor%dims = 0
+        make_descriptor%dims(1:size(dims)) = dims
+        make_descriptor%data = data
+    end
+
+    type(c_ptr) function gen_bind_array_int1(arr)
+        integer(c_int), dimension(:), target :: arr
+        if (.not. is_contiguous(arr)) error stop "gen_bind_array: the array is not contiguous"
+        gen_bind_array_int1 = gen_bind_array_impl(make_descriptor(1, shape(arr), c_loc(arr(lbound(arr, 1)))))
+    end
+    type(c_ptr) function gen_bind_array_int2(arr)
+        integer(c_int), dimension(:,:), target :: arr
+        if (.not. is_contiguous(arr)) error stop "gen_bind_array: the array is not contiguous"
+        gen_bind_array_int2 = gen_bind_array_impl(make_descriptor(1, shape(arr), &
+            c_loc(arr(lbound(arr, 1), lbound(arr, 2)))))
+    end
+    type(c_ptr) function gen_bind_array_int3(arr)
+        integer(c_int), dimension(:,:,:), target :: arr
+        if (.not. is_contiguous(arr)) error stop "gen_bind_array: the array is not contiguous"
+        gen_bind_array_int3 = gen_bind_array_impl(make_descriptor(1, shape(arr), &
+            c_loc(arr(lbound(arr, 1), lbound(arr, 2), lbound(arr, 3)))))
+    end
+    type(c_ptr) function gen_bind_array_float1(arr)
+        real(c_float), dimension(:), target :: arr
+        if (.not. is_contiguous(arr)) error stop "gen_bind_array: the array is not contiguous"
+        gen_bind_array_float1 = gen_bind_array_impl(make_descriptor(5, shape(arr), c_loc(arr(lbound(arr, 1)))))
+    end
+    type(c_ptr) function gen_bind_array_float2(arr)
+        real(c_float), dimension(:,:), target :: arr
+        if (.not. is_contiguous(arr)) error stop "gen_bind_array: the array is not contiguous"
+        gen_bind_array_float2 = gen_bind_array_impl(make_descriptor(5, shape(arr), &
+            c_loc(arr(lbound(arr, 1), lbound(arr, 2)))))
+    end
+    type(c_ptr) function gen_bind_array_float3(arr)
+        real(c_float), dimension(:,:,:), target :: arr
+        if (.not. is_contiguous(arr)) error stop "gen_bind_array: the array is not contiguous"
+        gen_bind_array_float3 = gen_bind_array_impl(make_descriptor(5, shape(arr), &
+            c_loc(arr(lbound(arr, 1), lbound(arr, 2), lbound(arr, 3)))))
+    end
+    type(c_ptr) function gen_bind_array_double1(arr)
+        real(c_double), dimension(:), target :: arr
+        if (.not. is_contiguous(arr)) error stop "gen_bind_array: the array is not contiguous"
+        gen_bind_array_double1 = gen_bind_array_impl(make_descriptor(6, shape(arr), c_loc(arr(lbound(arr, 1)))))
+    end
+    type(c_ptr) function gen_bind_array_double2(arr)
+        real(c_double), dimension(:,:), target :: arr
+        if (.not. is_contiguous(arr)) error stop "gen_bind_array: the array is not contiguous"
+        gen_bind_array_double2 = gen_bind_array_impl(make_descriptor(6, shape(arr), &
+            c_loc(arr(lbound(arr, 1), lbound(arr, 2)))))
+    end
+    type(c_ptr) function gen_bind_array_double3(arr)
+        real(c_double), dimension(:,:,:), target :: arr
+        if (.not. is_contiguous(arr)) error stop "gen_bind_array: the array is not contiguous"
+        gen_bind_array_double3 = gen_bind_array_impl(make_descriptor(6, shape(arr), &
+            c_loc(arr(lbound(arr, 1), lbound(arr, 2), lbound(arr, 3)))))
+    end
+
+    subroutine gen_rebind_array_int1(bound, arr)
+        type(c_ptr), intent(in) :: bound
+        integer(c_int), dimension(:), target :: arr
+        if (.not. is_contiguous(arr)) error stop "gen_rebind_array: the array is not contiguous"
+        call gen_rebind_array_impl(bound, make_descriptor(1, shape(arr), c_loc(arr(lbound(arr, 1)))))
+    end
+    subroutine gen_rebind_array_int2(bound, arr)
+        type(c_ptr), intent(in) :: bound
+        integer(c_int), dimension(:,:), target :: arr
+        if (.not. is_contiguous(arr)) error stop "gen_rebind_array: the array is not contiguous"
+        call gen_rebind_array_impl(bound, make_descriptor(1, shape(arr), &
+            c_loc(arr(lbound(arr, 1), lbound(arr, 2)))))
+    end
+    subroutine gen_rebind_array_int3(bound, arr)
+        type(c_ptr), intent(in) :: bound
+        integer(c_int), dimension(:,:,:), target :: arr
+        if (.not. is_contiguous(arr)) error stop "gen_rebind_array: the array is not contiguous"
+        call gen_rebind_array_impl(bound, make_descriptor(1, shape(arr), &
+            c_loc(arr(lbound(arr, 1), lbound(arr, 2), lbound(arr, 3)))))
+    end
+    subroutine gen_rebind_array_float1(bound, arr)
+        type(c_ptr), intent(in) :: bound
+        real(c_float), dimension(:), target :: arr
+        if (.not. is_contiguous(arr)) error stop "gen_rebind_array: the array is not contiguous"
+        call gen_rebind_array_impl(bound, make_descriptor(5, shape(arr), c_loc(arr(lbound(arr, 1)))))
+    end
+    subroutine gen_rebind_array_float2(bound, arr)
+        type(c_ptr), intent(in) :: bound
+        real(c_float), dimension(:,:), target :: arr
+        if (.not. is_contiguous(arr)) error stop "gen_rebind_array: the array is not contiguous"
+        call gen_rebind_array_impl(bound, make_descriptor(5, shape(arr), &
+            c_loc(arr(lbound(arr, 1), lbound(arr, 2)))))
+    end
+    subroutine gen_rebind_array_float3(bound, arr)
+        type(c_ptr), intent(in) :: bound
+        real(c_float), dimension(:,:,:), target :: arr
+        if (.not. is_contiguous(arr)) error stop "gen_rebind_array: the array is not contiguous"
+        call gen_rebind_array_impl(bound, make_descriptor(5, shape(arr), &
+            c_loc(arr(lbound(arr, 1), lbound(arr, 2), lbound(arr, 3)))))
+    end
+    subroutine gen_rebind_array_double1(bound, arr)
+        type(c_ptr), intent(in) :: bound
+        real(c_double), dimension(:), target :: arr
+        if (.not. is_contiguous(arr)) error stop "gen_rebind_array: the array is not contiguous"
+        call gen_rebind_array_impl(bound, make_descriptor(6, shape(arr), c_loc(arr(lbound(arr, 1)))))
+    end
+    subroutine gen_rebind_array_double2(bound, arr)
+        type(c_ptr), intent(in) :: bound
+        real(c_double), dimension(:,:), target :: arr
+        if (.not. is_contiguous(arr)) error stop "gen_rebind_array: the array is not contiguous"
+        call gen_rebind_array_impl(bound, make_descriptor(6, shape(arr), &
+            c_loc(arr(lbound(arr, 1), lbound(arr, 2)))))
+    end
+    subroutine gen_rebind_array_double3(bound, arr)
+        type(c_ptr), intent(in) :: bound
+        real(c_double), dimension(:,:,:), target :: arr
+        if (.not. is_contiguous(arr)) error stop "gen_rebind_array: the array is not contiguous"
+        call gen_rebind_array_impl(bound, make_descriptor(6, shape(arr), &
+            c_loc(arr(lbound(arr, 1), lbound(arr, 2), lbound(arr, 3)))))
+    end
+end
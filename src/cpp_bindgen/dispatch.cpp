@@ -0,0 +1,74 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifdef _WIN32
+#include <string>
+
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+#include <cpp_bindgen/dispatch.h>
+
+#ifdef _WIN32
+namespace {
+    thread_local std::string last_error;
+
+    void set_last_error(char const *what) { last_error = what + std::to_string(GetLastError()); }
+} // namespace
+
+void *gen_dispatch_open(char const *path) {
+    HMODULE res = LoadLibraryA(path);
+    if (!res)
+        set_last_error("LoadLibrary failed with error ");
+    return reinterpret_cast<void *>(res);
+}
+
+gen_dispatch_function gen_dispatch_symbol(void *library, char const *name) {
+    FARPROC res = GetProcAddress(reinterpret_cast<HMODULE>(library), name);
+    if (!res)
+        set_last_error("GetProcAddress failed with error ");
+    return reinterpret_cast<gen_dispatch_function>(res);
+}
+
+void gen_dispatch_close(void *library) {
+    if (library)
+        FreeLibrary(reinterpret_cast<HMODULE>(library));
+}
+
+char const *gen_dispatch_error() { return last_error.empty() ? nullptr : last_error.c_str(); }
+#else
+namespace {
+    thread_local char const *last_error = nullptr;
+} // namespace
+
+void *gen_dispatch_open(char const *path) {
+    void *res = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+    if (!res)
+        last_error = dlerror();
+    return res;
+}
+
+gen_dispatch_function gen_dispatch_symbol(void *library, char const *name) {
+    dlerror();
+    void *res = dlsym(library, name);
+    if (!res)
+        last_error = dlerror();
+    return reinterpret_cast<gen_dispatch_function>(res);
+}
+
+void gen_dispatch_close(void *library) {
+    if (library)
+        dlclose(library);
+}
+
+char const *gen_dispatch_error() { return last_error; }
+#endif
@@ -0,0 +1,40 @@
+! GridTools
+!
+! Copyright (c) 2014-2019, ETH Zurich
+! All rights reserved.
+!
+! Please, refer to the LICENSE file in the root directory.
+! SPDX-License-Identifier: BSD-3-Clause
+
+module gen_dispatch
+    implicit none
+    interface
+        type(c_ptr) function gen_dispatch_open_impl(path) bind(c, name="gen_dispatch_open")
+            use iso_c_binding
+            character(kind=c_char), dimension(*) :: path
+        end
+        type(c_funptr) function gen_dispatch_symbol_impl(library, name) bind(c, name="gen_dispatch_symbol")
+            use iso_c_binding
+            type(c_ptr), value :: library
+            character(kind=c_char), dimension(*) :: name
+        end
+        subroutine gen_dispatch_close(library) bind(c)
+            use iso_c_binding
+            type(c_ptr), value :: library
+        end
+    end interface
+contains
+    type(c_ptr) function gen_dispatch_open(path)
+        use iso_c_binding
+        character(*), intent(in) :: path
+
+        gen_dispatch_open = gen_dispatch_open_impl(trim(path) // c_null_char)
+    end
+    type(c_funptr) function gen_dispatch_symbol(library, name)
+        use iso_c_binding
+        type(c_ptr), intent(in) :: library
+        character(*), intent(in) :: name
+
+        gen_dispatch_symbol = gen_dispatch_symbol_impl(library, trim(name) // c_null_char)
+    end
+end
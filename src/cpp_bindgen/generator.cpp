@@ -8,58 +8,481 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <algorithm>
 #include <cassert>
+#include <cstdint>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
 #include <cpp_bindgen/generator.hpp>
 
 namespace cpp_bindgen {
-    namespace {
-        class fortran_generics {
-            std::map<char const *, std::vector<const char *>, _impl::c_string_less> m_procedures;
-
-          public:
-            void add(char const *generic_name, char const *concrete_name) {
-                m_procedures[generic_name].push_back(concrete_name);
-            }
-            friend std::ostream &operator<<(std::ostream &strm, fortran_generics const &obj) {
-                const std::string prefix = "    ";
-                for (auto &&item : obj.m_procedures) {
-                    strm << "  interface " << item.first << "\n";
-                    std::string line = "";
-                    line += "procedure ";
-                    bool need_comma = false;
-                    for (auto &&procedure : item.second) {
-                        if (need_comma)
-                            line += ", ";
-                        line += procedure;
-                        need_comma = true;
+    namespace _impl {
+        namespace {
+#ifdef __ELF__
+            template <class Record>
+            using record_entries_t = Record const *const[];
+
+            // defined by the linker if any object file has the section, see GEN_ADD_RECORD_IMPL
+            extern "C" {
+            __attribute__((weak, visibility("hidden"))) extern record_entries_t<declaration_record>
+                __start_gen_declarations, __stop_gen_declarations;
+            __attribute__((weak, visibility("hidden"))) extern record_entries_t<generic_record> __start_gen_generics,
+                __stop_gen_generics;
+            __attribute__((weak, visibility("hidden"))) extern record_entries_t<c_attributes_record>
+                __start_gen_c_attributes, __stop_gen_c_attributes;
+            }
+
+            template <class Record>
+            std::vector<Record const *> section_records(Record const *const *begin, Record const *const *end) {
+                return begin ? std::vector<Record const *>(begin, end) : std::vector<Record const *>();
+            }
+
+            std::vector<declaration_record const *> get_records(declaration_record const *) {
+                return section_records<declaration_record>(__start_gen_declarations, __stop_gen_declarations);
+            }
+            std::vector<generic_record const *> get_records(generic_record const *) {
+                return section_records<generic_record>(__start_gen_generics, __stop_gen_generics);
+            }
+            std::vector<c_attributes_record const *> get_records(c_attributes_record const *) {
+                return section_records<c_attributes_record>(__start_gen_c_attributes, __stop_gen_c_attributes);
+            }
+#else
+            template <class Record>
+            std::vector<Record const *> &registered_records() {
+                static std::vector<Record const *> obj;
+                return obj;
+            }
+
+            template <class Record>
+            std::vector<Record const *> get_records(Record const *) {
+                return registered_records<Record>();
+            }
+#endif
+
+            /// The records of the type `Record`, sorted by their key, which is unique.
+            template <class Record, class Key>
+            std::vector<Record const *> sorted_records(Key key) {
+                auto res = get_records(static_cast<Record const *>(nullptr));
+                std::stable_sort(res.begin(), res.end(), [&](Record const *lhs, Record const *rhs) {
+                    return c_string_less()(key(lhs), key(rhs));
+                });
+                assert(std::adjacent_find(res.begin(), res.end(), [&](Record const *lhs, Record const *rhs) {
+                    return !c_string_less()(key(lhs), key(rhs));
+                }) == res.end());
+                return res;
+            }
+
+            std::vector<declaration_record const *> const &get_declarations() {
+                static const std::vector<declaration_record const *> obj = sorted_records<declaration_record>(
+                    [](declaration_record const *record) { return record->m_c_name; });
+                return obj;
+            }
+
+            class fortran_generics {
+                std::map<char const *, std::vector<generic_record const *>, c_string_less> m_procedures;
+
+              public:
+                fortran_generics() {
+                    for (auto &&record : get_records(static_cast<generic_record const *>(nullptr)))
+                        m_procedures[record->m_generic_name].push_back(record);
+                    for (auto &&item : m_procedures)
+                        std::stable_sort(item.second.begin(),
+                            item.second.end(),
+                            [](generic_record const *lhs, generic_record const *rhs) {
+                                return lhs->m_order < rhs->m_order;
+                            });
+                }
+
+                friend std::ostream &operator<<(std::ostream &strm, fortran_generics const &obj) {
+                    const std::string prefix = "    ";
+                    for (auto &&item : obj.m_procedures) {
+                        strm << "  interface " << item.first << "\n";
+                        std::string line = "";
+                        line += "procedure ";
+                        bool need_comma = false;
+                        for (auto &&procedure : item.second) {
+                            if (need_comma)
+                                line += ", ";
+                            line += procedure->m_concrete_name;
+                            need_comma = true;
+                        }
+                        write_wrapped_line(strm, line, prefix);
+                        strm << "  end interface\n";
                     }
-                    strm << wrap_line(line, prefix);
-                    strm << "  end interface\n";
+                    return strm;
                 }
-                return strm;
+            };
+
+            int submodule_index(declaration_record const *record, int submodules) {
+                // FNV-1a, the submodule of a wrapper does not depend on the other bindings
+                std::uint32_t hash = 2166136261u;
+                for (char const *c = record->m_fortran_name; *c; ++c)
+                    hash = (hash ^ static_cast<unsigned char>(*c)) * 16777619u;
+                return static_cast<int>(hash % static_cast<std::uint32_t>(submodules)) + 1;
             }
-        };
 
-        fortran_generics &get_fortran_generics() {
-            static fortran_generics obj;
-            return obj;
-        }
-    } // namespace
+            char const *const async_note[] = {
+                "Asynchronous: returns a future handle immediately, the result is obtained with gen_wait(future).",
+                "Arrays, pointers and handles passed as arguments must stay valid until gen_wait(future) has returned.",
+                nullptr};
 
-    namespace _impl {
-        void entities::add(char const *name, generator_t generator) {
-            bool ok = m_generators.emplace(name, std::move(generator)).second;
-            assert(ok);
-        }
+            void write_async_note(std::ostream &strm, char const *comment) {
+                for (char const *const *line = async_note; *line; ++line)
+                    strm << comment << *line << "\n";
+            }
+
+            void write_c_binding(std::ostream &strm, declaration_record const &record) {
+                c_signature_info const &signature = *record.m_c_signature;
+                c_attributes_record const *attributes = find_c_attributes_record(record.m_c_name);
+                bool restrict_pointers = attributes && attributes->m_restrict;
+                if (record.m_kind == declaration_kind::async)
+                    write_async_note(strm, "// ");
+                signature.m_result.m_write_c_type(strm);
+                strm << " " << record.m_c_name << "(";
+                for (int i = 0; i < signature.m_arity; ++i) {
+                    if (i)
+                        strm << ", ";
+                    signature.m_params[i].m_write_c_type(strm);
+                    if (restrict_pointers && signature.m_params[i].m_c_array)
+                        strm << " GEN_RESTRICT";
+                }
+                strm << ")";
+                bool first = true;
+                for (int i = 0; i < signature.m_arity; ++i)
+                    if (attributes ? attributes->m_nonnull[i] : signature.m_params[i].m_nonnull) {
+                        strm << (first ? " GEN_NONNULL(" : ", ") << i + 1;
+                        first = false;
+                    }
+                if (!first)
+                    strm << ")";
+                if (attributes && attributes->m_nothrow)
+                    strm << " GEN_NOTHROW";
+                strm << ";\n";
+            }
+
+            /// Writes the type of a pointer to the binding, declaring `name` unless it is empty (i.e. in a cast).
+            void write_c_function_pointer(std::ostream &strm, declaration_record const &record, char const *name) {
+                c_signature_info const &signature = *record.m_c_signature;
+                signature.m_result.m_write_c_type(strm);
+                strm << " (*" << name << ")(";
+                for (int i = 0; i < signature.m_arity; ++i) {
+                    if (i)
+                        strm << ", ";
+                    signature.m_params[i].m_write_c_type(strm);
+                }
+                strm << ")";
+            }
+
+            char const *fortran_function_specifier(c_signature_info const &signature) {
+                return signature.m_result.m_fortran_type ? "function" : "subroutine";
+            }
+
+            std::string fortran_return_type(c_signature_info const &signature) {
+                return signature.m_result.m_fortran_type
+                           ? signature.m_result.m_fortran_type() + " " + fortran_function_specifier(signature)
+                           : fortran_function_specifier(signature);
+            }
+
+            bool has_array_descriptor(c_signature_info const &signature) {
+                for (int i = 0; i < signature.m_arity; ++i)
+                    if (signature.m_params[i].m_descriptor)
+                        return true;
+                return false;
+            }
+
+            /// Appends the dummy argument list `arg0, arg1, ...` of a procedure with `arity` arguments to `line`.
+            void append_fortran_args(std::string &line, int arity) {
+                for (int i = 0; i < arity; ++i) {
+                    if (i)
+                        line += ", ";
+                    line.append("arg").append(std::to_string(i));
+                }
+            }
+
+            bool has_fortran_wrapper(declaration_record const &record) {
+                return record.m_wrapper_params || record.m_kind == declaration_kind::elemental;
+            }
+
+            /**
+             * @brief This function writes the `interface`-section of the fortran-code.
+             * @param strm Stream, where the output will be written to
+             * @param record The binding, its name in the c-bindings of the module is m_fortran_cbindings_name.
+             * @param abstract Writes the abstract interface `<m_fortran_cbindings_name>_t` of the procedure pointer
+             * to the binding instead, see generate_fortran_dispatch().
+             */
+            void write_fortran_binding(std::ostream &strm, declaration_record const &record, bool abstract = false) {
+                c_signature_info const &signature = *record.m_c_signature;
+                char const *c_name = record.m_c_name;
+                char const *fortran_name = record.m_fortran_cbindings_name;
+                if (record.m_kind == declaration_kind::async && !has_fortran_wrapper(record))
+                    write_async_note(strm, "    ! ");
+                std::string line = fortran_return_type(signature);
+                line.append(" ").append(fortran_name).append(abstract ? "_t(" : "(");
+                append_fortran_args(line, signature.m_arity);
+                line += ")";
+                if (abstract || strcmp(c_name, fortran_name) == 0)
+                    line += " bind(c)";
+                else
+                    line.append(" bind(c, name=\"").append(c_name).append("\")");
+                write_wrapped_line(strm, line, "    ");
+                strm << "      use iso_c_binding\n";
+                if (has_array_descriptor(signature))
+                    strm << "      use gen_array_descriptor\n";
+                for (int i = 0; i < signature.m_arity; ++i)
+                    strm << "      " << signature.m_params[i].m_fortran_type() << " :: arg" << i << "\n";
+                strm << "    end " << fortran_function_specifier(signature) << "\n";
+            }
+
+            /**
+             * @brief This function writes the statements filling a gen_fortran_array_descriptor from a Fortran array.
+             * @param strm Stream, where the output will be written to
+             * @param var_name The name of the Fortran array variable.
+             * @param desc_name The name of the descriptor variable.
+             * @param meta The meta-data (type, rank and is_acc_present) of the array.
+             */
+            void write_fortran_descriptor_setup(std::ostream &strm,
+                std::string const &var_name,
+                std::string const &desc_name,
+                gen_fortran_array_descriptor const &meta) {
+                std::string c_loc = "c_loc(" + var_name + "(";
+                for (int i = 0; i < meta.rank; ++i) {
+                    if (i)
+                        c_loc += ",";
+                    c_loc += "lbound(" + var_name + ", " + std::to_string(i + 1) + ")";
+                }
+                c_loc += "))";
+                if (meta.is_acc_present)
+                    strm << "      !$acc data present(" << var_name << ")\n" //
+                         << "      !$acc host_data use_device(" << var_name << ")\n";
+
+                strm << "      " << desc_name << "%rank = " << meta.rank << "\n"                 //
+                     << "      " << desc_name << "%type = " << meta.type << "\n"                 //
+                     << "      " << desc_name << "%dims = reshape(shape(" << var_name << "), &\n" //
+                     << "        shape(" << desc_name << "%dims), (/0/))\n"                       //
+                     << "      " << desc_name << "%data = " << c_loc << "\n";
+                if (meta.is_acc_present)
+                    strm << "      !$acc end host_data\n" //
+                         << "      !$acc end data\n";
+                strm << "\n";
+            }
+
+            /// Writes the first line of a Fortran wrapper, `header` is its declaration without the `module` prefix.
+            void write_fortran_wrapper_header(
+                std::ostream &strm, std::string const &header, char const *fortran_name, fortran_wrapper_part part) {
+                if (part == fortran_wrapper_part::module_procedure)
+                    strm << "    module procedure " << fortran_name << "\n";
+                else if (part == fortran_wrapper_part::interface_body)
+                    write_wrapped_line(strm, "module " + header, "    ");
+                else
+                    write_wrapped_line(strm, header, "    ");
+            }
+
+            /// Writes the last line of a Fortran wrapper, `specifier` is `function` or `subroutine`.
+            void write_fortran_wrapper_end(std::ostream &strm, char const *specifier, fortran_wrapper_part part) {
+                strm << "    end " << (part == fortran_wrapper_part::module_procedure ? "procedure" : specifier)
+                     << "\n";
+            }
+
+            /**
+             * @brief This function writes the `contains`-section of the fortran-code.
+             * @param strm Stream, where the output will be written to
+             * @param record The binding, the wrapper is named m_fortran_name and calls m_fortran_cbindings_name.
+             * @param part The part of the wrapper that is written, see fortran_wrapper_part.
+             */
+            void write_fortran_wrapper(
+                std::ostream &strm, declaration_record const &record, fortran_wrapper_part part) {
+                c_signature_info const &signature = *record.m_c_signature;
+                fortran_wrapper_param_info const *params = record.m_wrapper_params;
+                char const *fortran_name = record.m_fortran_name;
+                if (record.m_kind == declaration_kind::async && part != fortran_wrapper_part::module_procedure)
+                    write_async_note(strm, "    ! ");
+
+                std::string line = fortran_return_type(signature);
+                line.append(" ").append(fortran_name).append("(");
+                append_fortran_args(line, signature.m_arity);
+                line += ")";
+                write_fortran_wrapper_header(strm, line, fortran_name, part);
+
+                strm << "      use iso_c_binding\n";
+                if (has_array_descriptor(signature))
+                    strm << "      use gen_array_descriptor\n";
+                if (part != fortran_wrapper_part::module_procedure)
+                    for (int i = 0; i < signature.m_arity; ++i)
+                        strm << "      " << params[i].m_type(record.m_deferred) << " :: arg" << i << "\n";
+                if (part == fortran_wrapper_part::interface_body)
+                    return write_fortran_wrapper_end(strm, fortran_function_specifier(signature), part);
+
+                for (int i = 0; i < signature.m_arity; ++i)
+                    if (params[i].m_descriptor())
+                        strm << "      type(gen_fortran_array_descriptor) :: descriptor" << i << "\n";
+                strm << "\n";
+
+                // the arrays of deferred bindings are not copied in, see fortran_array_attributes()
+                bool has_checks = false;
+                for (int i = 0; i < signature.m_arity; ++i)
+                    if (record.m_deferred && params[i].m_descriptor()) {
+                        strm << "      if (.not. is_contiguous(arg" << i << ")) error stop \"" << fortran_name
+                             << ": arg" << i << " is not contiguous\"\n";
+                        has_checks = true;
+                    }
+                // the arrays with static extents must have exactly that shape, see fortran_assumed_shape()
+                for (int i = 0; i < signature.m_arity; ++i)
+                    if (params[i].m_static_extents) {
+                        gen_fortran_array_descriptor const &meta = *params[i].m_descriptor();
+                        line = "if (any(shape(arg" + std::to_string(i) + ") /= (/";
+                        for (int d = 0; d < meta.rank; ++d)
+                            line.append(d ? ", " : "").append(std::to_string(meta.dims[d]));
+                        line.append("/))) error stop \"")
+                            .append(fortran_name)
+                            .append(": arg" + std::to_string(i) + " has the wrong shape\"");
+                        write_wrapped_line(strm, line, "      ");
+                        has_checks = true;
+                    }
+                if (has_checks)
+                    strm << "\n";
+
+                for (int i = 0; i < signature.m_arity; ++i)
+                    if (gen_fortran_array_descriptor const *meta = params[i].m_descriptor())
+                        write_fortran_descriptor_setup(
+                            strm, "arg" + std::to_string(i), "descriptor" + std::to_string(i), *meta);
+
+                if (signature.m_result.m_fortran_type)
+                    line.assign(fortran_name).append(" = ");
+                else
+                    line.assign("call ");
+                line.append(record.m_fortran_cbindings_name).append("(");
+                for (int i = 0; i < signature.m_arity; ++i) {
+                    if (i)
+                        line += ", ";
+                    line.append(params[i].m_descriptor() ? "descriptor" : "arg").append(std::to_string(i));
+                }
+                line += ")";
+                write_wrapped_line(strm, line, "      ");
+
+                write_fortran_wrapper_end(strm, fortran_function_specifier(signature), part);
+            }
+
+            /// Maximal rank of the arrays accepted by the Fortran wrappers of elemental bindings.
+            constexpr int elemental_max_rank = 3;
+
+            /**
+             * @brief This function writes the `contains`-section of the fortran-code for the array variant of an
+             * elemental binding: one function per rank up to elemental_max_rank, named `m_fortran_name` followed by
+             * the rank.
+             * @param strm Stream, where the output will be written to
+             * @param record The array variant, its name in the c-bindings-part of the module is
+             * m_fortran_cbindings_name.
+             * @param part The part of the wrappers that is written, see fortran_wrapper_part.
+             */
+            void write_fortran_elemental_wrapper(
+                std::ostream &strm, declaration_record const &record, fortran_wrapper_part part) {
+                gen_fortran_array_kind const *kinds = record.m_elemental_kinds;
+                // the array variant takes the descriptor of the result first
+                int arity = record.m_c_signature->m_arity - 1;
 
-        std::ostream &operator<<(std::ostream &strm, entities const &obj) {
-            for (auto &&item : obj.m_generators)
-                item.second(strm, item.first);
-            return strm;
+                for (int rank = 1; rank <= elemental_max_rank; ++rank) {
+                    const std::string name = record.m_fortran_name + std::to_string(rank);
+                    gen_fortran_array_descriptor meta;
+                    meta.rank = rank;
+                    meta.is_acc_present = false;
+
+                    std::string dimensions = "dimension(";
+                    std::string result_dimensions = "dimension(";
+                    for (int i = 0; i < rank; ++i) {
+                        if (i) {
+                            dimensions += ",";
+                            result_dimensions += ",";
+                        }
+                        dimensions += ":";
+                        result_dimensions += "size(arg0, " + std::to_string(i + 1) + ")";
+                    }
+                    dimensions += ")";
+                    result_dimensions += ")";
+
+                    std::string line = "function " + name + "(";
+                    append_fortran_args(line, arity);
+                    line += ") result(res)";
+                    write_fortran_wrapper_header(strm, line, name.c_str(), part);
+
+                    strm << "      use iso_c_binding\n";
+                    strm << "      use gen_array_descriptor\n";
+                    if (part != fortran_wrapper_part::module_procedure) {
+                        for (int i = 0; i < arity; ++i)
+                            strm << "      " << fortran_array_element_type_name(kinds[i + 1]) << ", " << dimensions
+                                 << ", contiguous, intent(in), target :: arg" << i << "\n";
+                        strm << "      " << fortran_array_element_type_name(kinds[0]) << ", " << result_dimensions
+                             << ", target :: res\n";
+                    }
+                    if (part == fortran_wrapper_part::interface_body) {
+                        write_fortran_wrapper_end(strm, "function", part);
+                        continue;
+                    }
+                    strm << "      type(gen_fortran_array_descriptor) :: descriptor_res\n";
+                    for (int i = 0; i < arity; ++i)
+                        strm << "      type(gen_fortran_array_descriptor) :: descriptor" << i << "\n";
+                    strm << "\n";
+
+                    meta.type = kinds[0];
+                    write_fortran_descriptor_setup(strm, "res", "descriptor_res", meta);
+                    for (int i = 0; i < arity; ++i) {
+                        meta.type = kinds[i + 1];
+                        write_fortran_descriptor_setup(
+                            strm, "arg" + std::to_string(i), "descriptor" + std::to_string(i), meta);
+                    }
+
+                    line.assign("call ").append(record.m_fortran_cbindings_name).append("(descriptor_res");
+                    for (int i = 0; i < arity; ++i)
+                        line.append(", descriptor").append(std::to_string(i));
+                    line += ")";
+                    write_wrapped_line(strm, line, "      ");
+                    write_fortran_wrapper_end(strm, "function", part);
+                }
+            }
+
+            /// `file` with `suffix` added before its extension, if it has one.
+            std::string add_file_name_suffix(std::string const &file, std::string const &suffix) {
+                auto dot = file.find_last_of('.');
+                auto slash = file.find_last_of('/');
+                if (dot == std::string::npos || (slash != std::string::npos && dot < slash))
+                    dot = file.size();
+                return file.substr(0, dot) + suffix + file.substr(dot);
+            }
+
+            /// Writes the Fortran wrappers of the binding, if it has any.
+            void write_fortran_wrappers(
+                std::ostream &strm, declaration_record const &record, fortran_wrapper_part part) {
+                if (record.m_kind == declaration_kind::elemental)
+                    write_fortran_elemental_wrapper(strm, record, part);
+                else if (record.m_wrapper_params)
+                    write_fortran_wrapper(strm, record, part);
+            }
+        } // namespace
+
+#ifndef __ELF__
+        record_registrar::record_registrar(declaration_record const *record) {
+            registered_records<declaration_record>().push_back(record);
+        }
+        record_registrar::record_registrar(generic_record const *record) {
+            registered_records<generic_record>().push_back(record);
         }
+        record_registrar::record_registrar(c_attributes_record const *record) {
+            registered_records<c_attributes_record>().push_back(record);
+        }
+#endif
 
-        fortran_generic_registrar::fortran_generic_registrar(char const *generic_name, char const *concrete_name) {
-            get_fortran_generics().add(generic_name, concrete_name);
+        c_attributes_record const *find_c_attributes_record(char const *name) {
+            static const std::vector<c_attributes_record const *> records =
+                sorted_records<c_attributes_record>([](c_attributes_record const *record) { return record->m_name; });
+            auto it = std::lower_bound(records.begin(),
+                records.end(),
+                name,
+                [](c_attributes_record const *record, char const *name) {
+                    return c_string_less()(record->m_name, name);
+                });
+            return it == records.end() || strcmp((*it)->m_name, name) ? nullptr : *it;
         }
 
         template <>
@@ -108,44 +531,52 @@ namespace cpp_bindgen {
         }
     } // namespace _impl
 
-    std::string wrap_line(const std::string &line, const std::string &prefix) {
-        static constexpr unsigned int max_line_length = 132;
-        const std::string line_divider = " &";
-        std::string ret = "";
-        std::string current_prefix = prefix;
-
-        auto it = line.begin();
-        while (it + max_line_length - current_prefix.size() < line.end()) {
-            auto next_it = it + max_line_length - line_divider.size() - current_prefix.size();
-            while (*(next_it - 1) != ',') {
-                --next_it;
-                if (next_it == line.begin() + 1)
+    void write_wrapped_line(std::ostream &strm, const std::string &line, const std::string &prefix) {
+        static constexpr std::size_t max_line_length = 132;
+        static constexpr char line_divider[] = " &\n";
+        static constexpr char continuation_indent[] = "   ";
+        std::size_t prefix_size = prefix.size();
+
+        std::size_t pos = 0;
+        while (line.size() - pos + prefix_size > max_line_length) {
+            // the divider " &" is placed after the last comma that fits
+            std::size_t next = pos + max_line_length - 2 - prefix_size;
+            while (line[next - 1] != ',') {
+                --next;
+                if (next == 1)
                     throw std::runtime_error("Too long line cannot be wrapped");
             }
-
-            ret.append(current_prefix);
-            ret.append(it, next_it);
-            ret.append(line_divider + "\n");
-
-            it = next_it;
+            strm << prefix;
+            if (pos)
+                strm << continuation_indent;
+            strm.write(line.data() + pos, next - pos) << line_divider;
+            pos = next;
             // more indentation on next line
-            current_prefix = prefix + "   ";
+            prefix_size = prefix.size() + sizeof(continuation_indent) - 1;
         }
-        ret += current_prefix;
-        ret.append(it, line.end());
-        ret += '\n';
-        return ret;
+        strm << prefix;
+        if (pos)
+            strm << continuation_indent;
+        strm.write(line.data() + pos, line.size() - pos) << '\n';
+    }
+
+    std::string wrap_line(const std::string &line, const std::string &prefix) {
+        std::ostringstream strm;
+        write_wrapped_line(strm, line, prefix);
+        return strm.str();
     }
 
     void generate_c_interface(std::ostream &strm) {
         strm << "// This file is generated!\n";
         strm << "#pragma once\n\n";
         strm << "#include <cpp_bindgen/array_descriptor.h>\n";
+        strm << "#include <cpp_bindgen/c_attributes.h>\n";
         strm << "#include <cpp_bindgen/handle.h>\n\n";
         strm << "#ifdef __cplusplus\n";
         strm << "extern \"C\" {\n";
         strm << "#endif\n\n";
-        strm << _impl::get_entities<_impl::c_bindings_traits>();
+        for (auto &&record : _impl::get_declarations())
+            _impl::write_c_binding(strm, *record);
         strm << "\n#ifdef __cplusplus\n";
         strm << "}\n";
         strm << "#endif\n";
@@ -156,11 +587,174 @@ namespace cpp_bindgen {
         strm << "module " << module_name << "\n";
         strm << "implicit none\n";
         strm << "  interface\n\n";
-        strm << _impl::get_entities<_impl::fortran_bindings_traits>();
+        for (auto &&record : _impl::get_declarations())
+            _impl::write_fortran_binding(strm, *record);
+        strm << "\n  end interface\n";
+        strm << _impl::fortran_generics();
+        strm << "contains\n";
+        for (auto &&record : _impl::get_declarations())
+            _impl::write_fortran_wrappers(strm, *record, _impl::fortran_wrapper_part::procedure);
+        strm << "end\n";
+    }
+
+    void generate_fortran_interface(std::ostream &strm, std::string const &module_name, int submodules) {
+        assert(submodules > 0);
+        strm << "! This file is generated!\n";
+        strm << "module " << module_name << "\n";
+        strm << "implicit none\n";
+        strm << "  interface\n\n";
+        for (auto &&record : _impl::get_declarations())
+            _impl::write_fortran_binding(strm, *record);
         strm << "\n  end interface\n";
-        strm << get_fortran_generics();
+        strm << "  interface\n\n";
+        for (auto &&record : _impl::get_declarations())
+            _impl::write_fortran_wrappers(strm, *record, _impl::fortran_wrapper_part::interface_body);
+        strm << "\n  end interface\n";
+        strm << _impl::fortran_generics();
+        strm << "end\n";
+    }
+
+    void generate_fortran_submodule(std::ostream &strm, std::string const &module_name, int index, int submodules) {
+        assert(index > 0 && index <= submodules);
+        strm << "! This file is generated!\n";
+        strm << "submodule (" << module_name << ") " << module_name << "_" << index << "\n";
+        strm << "implicit none\n";
+        strm << "contains\n";
+        for (auto &&record : _impl::get_declarations())
+            if (_impl::has_fortran_wrapper(*record) && _impl::submodule_index(record, submodules) == index)
+                _impl::write_fortran_wrappers(strm, *record, _impl::fortran_wrapper_part::module_procedure);
+        strm << "end\n";
+    }
+
+    std::string fortran_submodule_file_name(std::string const &fortran_file, int index) {
+        return _impl::add_file_name_suffix(fortran_file, "_" + std::to_string(index));
+    }
+
+    void generate_version_script(std::ostream &strm) {
+        strm << "/* This file is generated! */\n";
+        strm << "{\n";
+        strm << "  global:\n";
+        for (auto &&record : _impl::get_declarations())
+            strm << "    " << record->m_c_name << ";\n";
+        strm << "  local:\n";
+        strm << "    *;\n";
+        strm << "};\n";
+    }
+
+    void generate_c_dispatch(std::ostream &strm, std::string const &name) {
+        strm << "// This file is generated!\n";
+        strm << "#pragma once\n\n";
+        strm << "#include <cpp_bindgen/array_descriptor.h>\n";
+        strm << "#include <cpp_bindgen/dispatch.h>\n";
+        strm << "#include <cpp_bindgen/handle.h>\n\n";
+        strm << "#ifdef __cplusplus\n";
+        strm << "extern \"C\" {\n";
+        strm << "#endif\n\n";
+        strm << "struct " << name << "_dispatch {\n";
+        strm << "    void *library;\n";
+        for (auto &&record : _impl::get_declarations()) {
+            if (record->m_kind == _impl::declaration_kind::async)
+                _impl::write_async_note(strm, "    // ");
+            strm << "    ";
+            _impl::write_c_function_pointer(strm, *record, record->m_c_name);
+            strm << ";\n";
+        }
+        strm << "};\n\n";
+        strm << "// The table has to be zero-initialized before it is loaded for the first time. Returns 0 if the library or\n";
+        strm << "// one of its functions can not be loaded (see gen_dispatch_error()), the table is left unchanged then.\n";
+        strm << "// Otherwise the library loaded into the table before is unloaded.\n";
+        strm << "static inline int " << name << "_load(struct " << name << "_dispatch *table, char const *path) {\n";
+        strm << "    struct " << name << "_dispatch loaded;\n";
+        strm << "    int ok;\n";
+        strm << "    loaded.library = gen_dispatch_open(path);\n";
+        strm << "    ok = loaded.library != 0;\n";
+        for (auto &&record : _impl::get_declarations()) {
+            strm << "    ok = ok && (loaded." << record->m_c_name << " = (";
+            _impl::write_c_function_pointer(strm, *record, "");
+            strm << ")gen_dispatch_symbol(loaded.library, \"" << record->m_c_name << "\"));\n";
+        }
+        strm << "    if (!ok) {\n";
+        strm << "        gen_dispatch_close(loaded.library);\n";
+        strm << "        return 0;\n";
+        strm << "    }\n";
+        strm << "    gen_dispatch_close(table->library);\n";
+        strm << "    *table = loaded;\n";
+        strm << "    return 1;\n";
+        strm << "}\n\n";
+        strm << "static inline void " << name << "_unload(struct " << name << "_dispatch *table) {\n";
+        strm << "    gen_dispatch_close(table->library);\n";
+        strm << "    table->library = 0;\n";
+        strm << "}\n";
+        strm << "\n#ifdef __cplusplus\n";
+        strm << "}\n";
+        strm << "#endif\n";
+    }
+
+    void generate_fortran_dispatch(std::ostream &strm, std::string const &module_name) {
+        auto const &declarations = _impl::get_declarations();
+        strm << "! This file is generated!\n";
+        strm << "module " << module_name << "_dispatch\n";
+        strm << "use iso_c_binding\n";
+        strm << "implicit none\n";
+        strm << "  abstract interface\n\n";
+        for (auto &&record : declarations)
+            _impl::write_fortran_binding(strm, *record, true);
+        strm << "\n  end interface\n";
+        for (auto &&record : declarations)
+            write_wrapped_line(strm,
+                std::string("procedure(") + record->m_fortran_cbindings_name + "_t), pointer :: " +
+                    record->m_fortran_cbindings_name + " => null()",
+                "  ");
+        strm << _impl::fortran_generics();
+        // the names of the module and of the local variables are prefixed, they must not hide the bindings
+        std::string const library = module_name + "_library";
+        std::string const new_library = module_name + "_new_library";
+        std::string const symbols = module_name + "_symbols";
+        std::string const index = module_name + "_i";
+        strm << "  type(c_ptr), private :: " << library << " = c_null_ptr\n";
         strm << "contains\n";
-        strm << _impl::get_entities<_impl::fortran_wrapper_traits>();
+        // the procedure pointers are only associated once all the functions are found
+        strm << "    logical function " << module_name << "_load(path)\n";
+        strm << "      use gen_dispatch\n";
+        strm << "      character(*), intent(in) :: path\n";
+        strm << "      type(c_ptr) :: " << new_library << "\n";
+        strm << "      type(c_funptr), dimension(" << std::max<std::size_t>(declarations.size(), 1) << ") :: " << symbols
+             << "\n";
+        strm << "      integer :: " << index << "\n\n";
+        strm << "      " << module_name << "_load = .false.\n";
+        strm << "      " << new_library << " = gen_dispatch_open(path)\n";
+        strm << "      if (.not. c_associated(" << new_library << ")) return\n";
+        for (std::size_t i = 0; i != declarations.size(); ++i)
+            write_wrapped_line(strm,
+                symbols + "(" + std::to_string(i + 1) + ") = gen_dispatch_symbol(" + new_library + ", \"" +
+                    declarations[i]->m_c_name + "\")",
+                "      ");
+        strm << "      do " << index << " = 1, " << declarations.size() << "\n";
+        strm << "        if (.not. c_associated(" << symbols << "(" << index << "))) then\n";
+        strm << "          call gen_dispatch_close(" << new_library << ")\n";
+        strm << "          return\n";
+        strm << "        end if\n";
+        strm << "      end do\n";
+        strm << "      call " << module_name << "_unload()\n";
+        strm << "      " << library << " = " << new_library << "\n";
+        for (std::size_t i = 0; i != declarations.size(); ++i)
+            write_wrapped_line(strm,
+                "call c_f_procpointer(" + symbols + "(" + std::to_string(i + 1) + "), " +
+                    declarations[i]->m_fortran_cbindings_name + ")",
+                "      ");
+        strm << "      " << module_name << "_load = .true.\n";
+        strm << "    end function\n";
+        strm << "    subroutine " << module_name << "_unload()\n";
+        strm << "      use gen_dispatch\n\n";
+        for (auto &&record : declarations)
+            strm << "      nullify(" << record->m_fortran_cbindings_name << ")\n";
+        strm << "      call gen_dispatch_close(" << library << ")\n";
+        strm << "      " << library << " = c_null_ptr\n";
+        strm << "    end subroutine\n";
+        for (auto &&record : declarations)
+            _impl::write_fortran_wrappers(strm, *record, _impl::fortran_wrapper_part::procedure);
         strm << "end\n";
     }
+
+    std::string dispatch_file_name(std::string const &file) { return _impl::add_file_name_suffix(file, "_dispatch"); }
 } // namespace cpp_bindgen
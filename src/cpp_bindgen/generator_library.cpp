@@ -0,0 +1,47 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <fstream>
+
+#include <cpp_bindgen/generator.hpp>
+
+/**
+ *  Compiled into the shared libraries of cpp_bindgen_add_library() in the CPP_BINDGEN_GENERATOR_TOOL mode: the
+ *  cpp_bindgen_generator tool loads the library and writes the declarations of its bindings with this entry point.
+ *  The generator is linked statically into each library, hence it walks the records of the library it is called from.
+ *  The dispatch tables (see generate_c_dispatch()) are written if `dispatch_name` is not null.
+ */
+extern "C" __attribute__((visibility("default"))) int cpp_bindgen_generate(
+    char const *c_file, char const *fortran_file, char const *module_name, int submodules, char const *dispatch_name) {
+    bool ok = true;
+    {
+        std::ofstream dst(fortran_file);
+        if (submodules > 0)
+            cpp_bindgen::generate_fortran_interface(dst, module_name, submodules);
+        else
+            cpp_bindgen::generate_fortran_interface(dst, module_name);
+        ok = ok && dst;
+    }
+    for (int i = 1; i <= submodules; ++i) {
+        std::ofstream dst(cpp_bindgen::fortran_submodule_file_name(fortran_file, i));
+        cpp_bindgen::generate_fortran_submodule(dst, module_name, i, submodules);
+        ok = ok && dst;
+    }
+    if (dispatch_name) {
+        std::ofstream c_dst(cpp_bindgen::dispatch_file_name(c_file));
+        cpp_bindgen::generate_c_dispatch(c_dst, dispatch_name);
+        std::ofstream fortran_dst(cpp_bindgen::dispatch_file_name(fortran_file));
+        cpp_bindgen::generate_fortran_dispatch(fortran_dst, module_name);
+        ok = ok && c_dst && fortran_dst;
+    }
+    std::ofstream dst(c_file);
+    cpp_bindgen::generate_c_interface(dst);
+    return ok && dst ? 0 : 1;
+}
@@ -8,15 +8,54 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <string>
 
 #include <cpp_bindgen/generator.hpp>
 
+namespace {
+    // the value of `arg` if it is the option `--<name>=<value>`, nullptr otherwise
+    char const *option_value(char const *arg, std::string const &name) {
+        std::string prefix = "--" + name + "=";
+        return std::strncmp(arg, prefix.c_str(), prefix.size()) ? nullptr : arg + prefix.size();
+    }
+} // namespace
+
+// generator <c_file> <fortran_file> <module_name> [<submodules>] [--version-script=<file>] [--dispatch=<name>]
 int main(int argc, const char *argv[]) {
+    int submodules = 0;
+    char const *version_script = nullptr;
+    char const *dispatch_name = nullptr;
+    for (int i = 4; i < argc; ++i)
+        if (char const *file = option_value(argv[i], "version-script"))
+            version_script = file;
+        else if (char const *name = option_value(argv[i], "dispatch"))
+            dispatch_name = name;
+        else
+            submodules = std::atoi(argv[i]);
     if (argc > 3) {
         std::ofstream dst(argv[2]);
-        cpp_bindgen::generate_fortran_interface(dst, argv[3]);
+        if (submodules > 0)
+            cpp_bindgen::generate_fortran_interface(dst, argv[3], submodules);
+        else
+            cpp_bindgen::generate_fortran_interface(dst, argv[3]);
+    }
+    for (int i = 1; i <= submodules; ++i) {
+        std::ofstream dst(cpp_bindgen::fortran_submodule_file_name(argv[2], i));
+        cpp_bindgen::generate_fortran_submodule(dst, argv[3], i, submodules);
+    }
+    if (version_script) {
+        std::ofstream dst(version_script);
+        cpp_bindgen::generate_version_script(dst);
+    }
+    if (dispatch_name) {
+        std::ofstream c_dst(cpp_bindgen::dispatch_file_name(argv[1]));
+        cpp_bindgen::generate_c_dispatch(c_dst, dispatch_name);
+        std::ofstream fortran_dst(cpp_bindgen::dispatch_file_name(argv[2]));
+        cpp_bindgen::generate_fortran_dispatch(fortran_dst, argv[3]);
     }
     if (argc > 1) {
         std::ofstream dst(argv[1]);
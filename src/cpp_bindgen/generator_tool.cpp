@@ -0,0 +1,50 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include <dlfcn.h>
+
+/**
+ *  cpp_bindgen_generator <library> <c_file> <fortran_file> <module_name> [<submodules>] [--dispatch=<name>]
+ *
+ *  Writes the C header and the Fortran module of the bindings of a shared library built by cpp_bindgen_add_library()
+ *  in the CPP_BINDGEN_GENERATOR_TOOL mode. The tool is built once and exports the runtime of the bindings, which the
+ *  libraries leave to the programs they are linked to.
+ */
+int main(int argc, const char *argv[]) {
+    static const char dispatch_option[] = "--dispatch=";
+    int submodules = 0;
+    char const *dispatch_name = nullptr;
+    for (int i = 5; i < argc; ++i)
+        if (std::strncmp(argv[i], dispatch_option, sizeof(dispatch_option) - 1) == 0)
+            dispatch_name = argv[i] + sizeof(dispatch_option) - 1;
+        else
+            submodules = std::atoi(argv[i]);
+    if (argc < 5 || argc > 7) {
+        std::cerr << "usage: " << argv[0]
+                  << " <library> <c_file> <fortran_file> <module_name> [<submodules>] [--dispatch=<name>]" << std::endl;
+        return 2;
+    }
+    void *library = dlopen(argv[1], RTLD_NOW | RTLD_LOCAL);
+    if (!library) {
+        std::cerr << dlerror() << std::endl;
+        return 1;
+    }
+    using generate_t = int(char const *, char const *, char const *, int, char const *);
+    auto generate = reinterpret_cast<generate_t *>(dlsym(library, "cpp_bindgen_generate"));
+    if (!generate) {
+        std::cerr << argv[1] << " has no declarations: " << dlerror() << std::endl;
+        return 1;
+    }
+    return generate(argv[2], argv[3], argv[4], submodules, dispatch_name);
+}
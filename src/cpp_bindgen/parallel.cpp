@@ -0,0 +1,212 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <cpp_bindgen/parallel.h>
+#include <cpp_bindgen/parallel.hpp>
+
+namespace cpp_bindgen {
+    namespace {
+        int env_int(char const *name) {
+            if (char const *env = std::getenv(name))
+                return std::atoi(env);
+            return 0;
+        }
+
+        int default_num_threads() {
+            int res = env_int("GEN_PARALLEL_NUM_THREADS");
+            if (res > 0)
+                return res;
+#ifdef _OPENMP
+            return omp_get_max_threads();
+#else
+            res = std::thread::hardware_concurrency();
+            return res > 0 ? res : 1;
+#endif
+        }
+
+        std::atomic<int> &grain_size() {
+            static std::atomic<int> obj(std::max(env_int("GEN_PARALLEL_GRAIN_SIZE"), 1));
+            return obj;
+        }
+
+#ifdef _OPENMP
+        std::atomic<int> &num_threads() {
+            static std::atomic<int> obj(default_num_threads());
+            return obj;
+        }
+
+        template <class Fun>
+        void run_tiles(int num_tiles, Fun const &fun) {
+#pragma omp parallel for schedule(static) num_threads(num_threads().load())
+            for (int tile = 0; tile < num_tiles; ++tile)
+                fun(tile);
+        }
+#else
+        /// A fixed set of threads, thread `i` always executes the i-th contiguous range of tiles.
+        class parallel_team {
+            std::mutex m_mutex;
+            std::condition_variable m_start;
+            std::condition_variable m_done;
+            std::vector<std::thread> m_workers;
+            std::function<void(int)> const *m_job = nullptr;
+            std::size_t m_generation = 0;
+            int m_pending = 0;
+            bool m_stop = false;
+
+            void work(int index) {
+                std::size_t generation = 0;
+                while (true) {
+                    std::function<void(int)> const *job;
+                    {
+                        std::unique_lock<std::mutex> lock(m_mutex);
+                        m_start.wait(lock, [&] { return m_stop || m_generation != generation; });
+                        if (m_stop)
+                            return;
+                        generation = m_generation;
+                        job = m_job;
+                    }
+                    (*job)(index);
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    if (--m_pending == 0)
+                        m_done.notify_one();
+                }
+            }
+
+          public:
+            explicit parallel_team(int num_threads) {
+                for (int i = 1; i < num_threads; ++i)
+                    m_workers.emplace_back(&parallel_team::work, this, i);
+            }
+
+            ~parallel_team() {
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_stop = true;
+                }
+                m_start.notify_all();
+                for (auto &worker : m_workers)
+                    worker.join();
+            }
+
+            int size() const { return m_workers.size() + 1; }
+
+            /// Calls `job(i)` on every thread i of the team, the calling thread is the thread 0.
+            void run(std::function<void(int)> const &job) {
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_job = &job;
+                    m_pending = m_workers.size();
+                    ++m_generation;
+                }
+                m_start.notify_all();
+                job(0);
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_done.wait(lock, [this] { return m_pending == 0; });
+            }
+        };
+
+        /// The idle teams, every concurrent caller of run_tiles() takes its own one.
+        struct parallel_pool {
+            std::mutex m_mutex;
+            int m_num_threads = default_num_threads();
+            std::vector<std::unique_ptr<parallel_team>> m_idle;
+        };
+
+        parallel_pool &get_parallel_pool() {
+            static parallel_pool obj;
+            return obj;
+        }
+
+        // set while the tiles of a parallel binding are executed, nested parallel bindings run serially
+        thread_local bool t_in_tiles = false;
+
+        template <class Fun>
+        void run_tiles(int num_tiles, Fun const &fun) {
+            if (t_in_tiles) {
+                for (int tile = 0; tile < num_tiles; ++tile)
+                    fun(tile);
+                return;
+            }
+            auto &pool = get_parallel_pool();
+            std::unique_ptr<parallel_team> team;
+            int num_threads;
+            {
+                std::lock_guard<std::mutex> lock(pool.m_mutex);
+                num_threads = pool.m_num_threads;
+                if (!pool.m_idle.empty()) {
+                    team = std::move(pool.m_idle.back());
+                    pool.m_idle.pop_back();
+                }
+            }
+            if (!team)
+                team.reset(new parallel_team(num_threads));
+            int size = team->size();
+            team->run([&](int index) {
+                t_in_tiles = true;
+                for (int tile = index * num_tiles / size; tile < (index + 1) * num_tiles / size; ++tile)
+                    fun(tile);
+                t_in_tiles = false;
+            });
+            // the team is dropped (outside of the lock) if the number of threads has changed in the meantime
+            std::lock_guard<std::mutex> lock(pool.m_mutex);
+            if (size == pool.m_num_threads)
+                pool.m_idle.push_back(std::move(team));
+        }
+#endif
+    } // namespace
+
+    void parallel_for_tiles(int size, std::function<void(int, int)> const &fun) {
+        int grain = grain_size();
+        int num_tiles = (size + grain - 1) / grain;
+        std::mutex error_mutex;
+        std::exception_ptr error;
+        run_tiles(num_tiles, [&](int tile) {
+            try {
+                fun(tile * grain, std::min(size, (tile + 1) * grain));
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if (!error)
+                    error = std::current_exception();
+            }
+        });
+        if (error)
+            std::rethrow_exception(error);
+    }
+} // namespace cpp_bindgen
+
+void gen_set_parallel_num_threads(int num_threads) {
+    num_threads = std::max(num_threads, 1);
+#ifdef _OPENMP
+    cpp_bindgen::num_threads() = num_threads;
+#else
+    auto &pool = cpp_bindgen::get_parallel_pool();
+    std::vector<std::unique_ptr<cpp_bindgen::parallel_team>> idle;
+    std::lock_guard<std::mutex> lock(pool.m_mutex);
+    pool.m_num_threads = num_threads;
+    // the threads of the idle teams are joined when `idle` goes out of scope, after the lock is released
+    idle.swap(pool.m_idle);
+#endif
+}
+
+void gen_set_parallel_grain_size(int grain_size) { cpp_bindgen::grain_size() = std::max(grain_size, 1); }
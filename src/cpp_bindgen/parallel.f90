@@ -0,0 +1,21 @@
+! GridTools
+!
+! Copyright (c) 2014-2019, ETH Zurich
+! All rights reserved.
+!
+! Please, refer to the LICENSE file in the root directory.
+! SPDX-License-Identifier: BSD-3-Clause
+
+module gen_parallel
+    implicit none
+    interface
+        subroutine gen_set_parallel_num_threads(num_threads) bind(c)
+            use iso_c_binding
+            integer(c_int), value :: num_threads
+        end
+        subroutine gen_set_parallel_grain_size(grain_size) bind(c)
+            use iso_c_binding
+            integer(c_int), value :: grain_size
+        end
+    end interface
+end
@@ -0,0 +1,145 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cpp_bindgen/profile.h>
+#include <cpp_bindgen/profile.hpp>
+
+namespace cpp_bindgen {
+    struct profile_slot {
+        std::string m_name;
+        profile_counters m_counters;
+        bool m_used = false;
+    };
+
+    namespace {
+        struct profile_totals {
+            std::uint64_t m_calls = 0;
+            std::uint64_t m_total = 0;
+            std::uint64_t m_min = std::numeric_limits<std::uint64_t>::max();
+            std::uint64_t m_max = 0;
+            std::uint64_t m_conversion = 0;
+            std::uint64_t m_impl = 0;
+        };
+
+        void add(profile_totals &dst, profile_counters const &counters) {
+            auto calls = counters.m_calls.load(std::memory_order_relaxed);
+            if (!calls)
+                return;
+            dst.m_calls += calls;
+            dst.m_total += counters.m_total.load(std::memory_order_relaxed);
+            dst.m_min = std::min(dst.m_min, counters.m_min.load(std::memory_order_relaxed));
+            dst.m_max = std::max(dst.m_max, counters.m_max.load(std::memory_order_relaxed));
+            dst.m_conversion += counters.m_conversion.load(std::memory_order_relaxed);
+            dst.m_impl += counters.m_impl.load(std::memory_order_relaxed);
+        }
+
+        void reset(profile_counters &counters) {
+            counters.m_calls = 0;
+            counters.m_total = 0;
+            counters.m_min = std::numeric_limits<std::uint64_t>::max();
+            counters.m_max = 0;
+            counters.m_conversion = 0;
+            counters.m_impl = 0;
+        }
+
+        struct profile_registry {
+            std::mutex m_mutex;
+            // the counters of the running threads, the unused slots are given to the next threads
+            std::vector<std::unique_ptr<profile_slot>> m_slots;
+            // the counters of the exited threads
+            std::map<std::string, profile_totals> m_exited;
+        };
+
+        // never destroyed, the threads still running at exit release their counters after the static destructors
+        profile_registry &get_profile_registry() {
+            static profile_registry *obj = new profile_registry;
+            return *obj;
+        }
+
+        double ms(std::uint64_t ns) { return ns * 1e-6; }
+        double us(std::uint64_t ns) { return ns * 1e-3; }
+    } // namespace
+
+    profile_thread_counters::profile_thread_counters(char const *name) {
+        auto &registry = get_profile_registry();
+        std::lock_guard<std::mutex> lock(registry.m_mutex);
+        auto it = std::find_if(registry.m_slots.begin(),
+            registry.m_slots.end(),
+            [](std::unique_ptr<profile_slot> const &slot) { return !slot->m_used; });
+        if (it == registry.m_slots.end()) {
+            registry.m_slots.emplace_back(new profile_slot);
+            it = registry.m_slots.end() - 1;
+        }
+        m_slot = it->get();
+        m_slot->m_name = name;
+        m_slot->m_used = true;
+        m_counters = &m_slot->m_counters;
+    }
+
+    profile_thread_counters::~profile_thread_counters() {
+        auto &registry = get_profile_registry();
+        std::lock_guard<std::mutex> lock(registry.m_mutex);
+        add(registry.m_exited[m_slot->m_name], m_slot->m_counters);
+        reset(m_slot->m_counters);
+        m_slot->m_used = false;
+    }
+
+    void profile_report(std::ostream &strm) {
+        std::map<std::string, profile_totals> totals;
+        {
+            auto &registry = get_profile_registry();
+            std::lock_guard<std::mutex> lock(registry.m_mutex);
+            for (auto &&item : registry.m_exited)
+                if (item.second.m_calls)
+                    totals.insert(item);
+            for (auto &&slot : registry.m_slots)
+                if (slot->m_used && slot->m_counters.m_calls.load(std::memory_order_relaxed))
+                    add(totals[slot->m_name], slot->m_counters);
+        }
+        std::size_t width = 8;
+        for (auto &&item : totals)
+            width = std::max(width, item.first.size());
+        strm << std::left << std::setw(width) << "binding" << std::right << std::setw(12) << "calls" << std::setw(14)
+             << "total [ms]" << std::setw(12) << "min [us]" << std::setw(12) << "avg [us]" << std::setw(12)
+             << "max [us]" << std::setw(14) << "impl [ms]" << std::setw(16) << "convert [ms]"
+             << "\n";
+        strm << std::fixed << std::setprecision(3);
+        for (auto &&item : totals) {
+            auto &t = item.second;
+            strm << std::left << std::setw(width) << item.first << std::right << std::setw(12) << t.m_calls
+                 << std::setw(14) << ms(t.m_total) << std::setw(12) << us(t.m_min) << std::setw(12)
+                 << us(t.m_total) / t.m_calls << std::setw(12) << us(t.m_max) << std::setw(14) << ms(t.m_impl)
+                 << std::setw(16) << ms(t.m_conversion) << "\n";
+        }
+    }
+} // namespace cpp_bindgen
+
+void gen_profile_report() {
+    cpp_bindgen::profile_report(std::cout);
+    std::cout.flush();
+}
+
+void gen_profile_reset() {
+    auto &registry = cpp_bindgen::get_profile_registry();
+    std::lock_guard<std::mutex> lock(registry.m_mutex);
+    registry.m_exited.clear();
+    for (auto &&slot : registry.m_slots)
+        cpp_bindgen::reset(slot->m_counters);
+}
@@ -0,0 +1,17 @@
+! GridTools
+!
+! Copyright (c) 2014-2019, ETH Zurich
+! All rights reserved.
+!
+! Please, refer to the LICENSE file in the root directory.
+! SPDX-License-Identifier: BSD-3-Clause
+
+module gen_profile
+    implicit none
+    interface
+        subroutine gen_profile_report() bind(c)
+        end
+        subroutine gen_profile_reset() bind(c)
+        end
+    end interface
+end
@@ -0,0 +1,156 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <exception>
+#include <future>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <cpp_bindgen/queue.h>
+#include <cpp_bindgen/queue.hpp>
+
+namespace cpp_bindgen {
+    namespace {
+        struct queue_state {
+            bool m_recording = false;
+            std::vector<queue_command> m_commands;
+        };
+
+        queue_state &get_queue_state() {
+            static thread_local queue_state obj;
+            return obj;
+        }
+
+        std::size_t element_size(gen_fortran_array_kind kind) {
+            switch (kind) {
+            case gen_fk_Bool:
+                return sizeof(bool);
+            case gen_fk_Int:
+                return sizeof(int);
+            case gen_fk_Short:
+                return sizeof(short);
+            case gen_fk_Long:
+                return sizeof(long);
+            case gen_fk_LongLong:
+                return sizeof(long long);
+            case gen_fk_Float:
+                return sizeof(float);
+            case gen_fk_Double:
+                return sizeof(double);
+            case gen_fk_LongDouble:
+                return sizeof(long double);
+            case gen_fk_SignedChar:
+                return sizeof(signed char);
+            }
+            return 0;
+        }
+
+        bool conflict(queue_access const &lhs, queue_access const &rhs) {
+            if (!lhs.m_bounded || !rhs.m_bounded)
+                return true;
+            return (lhs.m_write || rhs.m_write) && lhs.m_begin < rhs.m_end && rhs.m_begin < lhs.m_end;
+        }
+
+        bool conflict(queue_command const &lhs, queue_command const &rhs) {
+            for (auto &&l : lhs.m_accesses)
+                for (auto &&r : rhs.m_accesses)
+                    if (conflict(l, r))
+                        return true;
+            return false;
+        }
+
+        void execute_serial(std::vector<queue_command> &commands) {
+            for (auto &&command : commands)
+                command.m_fun();
+        }
+
+        void execute_wave(queue_command *first, queue_command *last) {
+            std::vector<std::future<void>> futures;
+            for (auto it = first; it + 1 < last; ++it) {
+                auto task = std::make_shared<std::packaged_task<void()>>(std::move(it->m_fun));
+                futures.push_back(task->get_future());
+                async_execute([task] { (*task)(); });
+            }
+            std::exception_ptr error;
+            try {
+                (last - 1)->m_fun();
+            } catch (...) {
+                error = std::current_exception();
+            }
+            // all calls of the wave have to finish before an exception leaves this function
+            for (auto &&future : futures) {
+                try {
+                    future.get();
+                } catch (...) {
+                    if (!error)
+                        error = std::current_exception();
+                }
+            }
+            if (error)
+                std::rethrow_exception(error);
+        }
+
+        // consecutive independent commands form a wave, the waves are executed one after the other
+        void execute_parallel(std::vector<queue_command> &commands) {
+            auto first = commands.data();
+            auto last = first + commands.size();
+            while (first != last) {
+                auto wave_end = first + 1;
+                for (; wave_end != last; ++wave_end) {
+                    bool independent = true;
+                    for (auto it = first; independent && it != wave_end; ++it)
+                        independent = !conflict(*it, *wave_end);
+                    if (!independent)
+                        break;
+                }
+                execute_wave(first, wave_end);
+                first = wave_end;
+            }
+        }
+
+        void flush(void (*execute)(std::vector<queue_command> &)) {
+            auto &state = get_queue_state();
+            state.m_recording = false;
+            std::vector<queue_command> commands;
+            commands.swap(state.m_commands);
+            execute(commands);
+        }
+    } // namespace
+
+    bool queue_is_recording() { return get_queue_state().m_recording; }
+
+    queue_access make_queue_access(gen_fortran_array_descriptor const &descriptor, bool write) {
+        auto size = element_size(descriptor.type);
+        if (!size || descriptor.rank < 0 || descriptor.rank > 7)
+            return {nullptr, nullptr, false, write};
+        for (int i = 0; i < descriptor.rank; ++i)
+            size *= descriptor.dims[i] < 0 ? 0 : descriptor.dims[i];
+        auto begin = static_cast<char const *>(descriptor.data);
+        return {begin, begin + size, true, write};
+    }
+
+    void queue_record(queue_command command) { get_queue_state().m_commands.push_back(std::move(command)); }
+
+    void queue_sync() {
+        auto &state = get_queue_state();
+        if (state.m_commands.empty())
+            return;
+        flush(execute_serial);
+        state.m_recording = true;
+    }
+} // namespace cpp_bindgen
+
+void gen_queue_begin() { cpp_bindgen::get_queue_state().m_recording = true; }
+
+void gen_queue_flush() { cpp_bindgen::flush(cpp_bindgen::execute_serial); }
+
+void gen_queue_flush_parallel() { cpp_bindgen::flush(cpp_bindgen::execute_parallel); }
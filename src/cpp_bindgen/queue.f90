@@ -0,0 +1,19 @@
+! GridTools
+!
+! Copyright (c) 2014-2019, ETH Zurich
+! All rights reserved.
+!
+! Please, refer to the LICENSE file in the root directory.
+! SPDX-License-Identifier: BSD-3-Clause
+
+module gen_queue
+    implicit none
+    interface
+        subroutine gen_queue_begin() bind(c)
+        end
+        subroutine gen_queue_flush() bind(c)
+        end
+        subroutine gen_queue_flush_parallel() bind(c)
+        end
+    end interface
+end
@@ -0,0 +1,64 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <algorithm>
+
+#include <cpp_bindgen/scratch.hpp>
+
+namespace cpp_bindgen {
+    namespace {
+        constexpr std::size_t initial_block_size = 64 * 1024;
+    }
+
+    void *scratch::allocate_slow(std::size_t size, std::size_t alignment) {
+        std::size_t needed = size + alignment - 1;
+        std::size_t next = m_cur ? m_block + 1 : 0;
+        while (next < m_blocks.size() && m_blocks[next].m_size < needed)
+            ++next;
+        if (next == m_blocks.size()) {
+            std::size_t block_size = m_blocks.empty() ? initial_block_size : 2 * m_blocks.back().m_size;
+            block_size = std::max(block_size, needed);
+            m_blocks.push_back({std::unique_ptr<char[]>(new char[block_size]), block_size});
+        }
+        m_block = next;
+        m_cur = m_blocks[next].m_data.get();
+        m_end = m_cur + m_blocks[next].m_size;
+        return allocate_bytes(size, alignment);
+    }
+
+    void scratch::release_slow(marker pos) {
+        if (m_blocks.empty())
+            return;
+        if (!pos.m_cur || (pos.m_block == 0 && pos.m_cur == m_blocks[0].m_data.get())) {
+            // the arena is empty again: merge the blocks, so that the next calls fit into a single one
+            if (m_blocks.size() > 1) {
+                std::size_t total = capacity();
+                m_blocks.clear();
+                m_blocks.push_back({std::unique_ptr<char[]>(new char[total]), total});
+            }
+            pos = {0, m_blocks[0].m_data.get()};
+        }
+        m_block = pos.m_block;
+        m_cur = pos.m_cur;
+        m_end = m_blocks[m_block].m_data.get() + m_blocks[m_block].m_size;
+    }
+
+    std::size_t scratch::capacity() const {
+        std::size_t res = 0;
+        for (auto const &block : m_blocks)
+            res += block.m_size;
+        return res;
+    }
+
+    scratch &thread_scratch() {
+        thread_local scratch obj;
+        return obj;
+    }
+} // namespace cpp_bindgen
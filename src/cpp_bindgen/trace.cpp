@@ -0,0 +1,251 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <cpp_bindgen/trace.h>
+#include <cpp_bindgen/trace.hpp>
+
+namespace cpp_bindgen {
+    namespace {
+        using trace_clock = std::chrono::steady_clock;
+
+        // a complete range: a wrapped ring buffer drops whole ranges, the begin and end events stay balanced
+        struct trace_event {
+            std::atomic<char const *> m_name;
+            std::atomic<trace_clock::rep> m_begin;
+            std::atomic<trace_clock::rep> m_duration;
+        };
+
+        struct trace_range {
+            char const *m_name;
+            trace_clock::time_point m_begin;
+        };
+
+        /**
+         * The ranges closed by a single thread. The owning thread writes without a lock, the flushing thread detects
+         * the events overwritten while it copied them by the count of written events (like a sequence lock).
+         */
+        class trace_buffer {
+            std::vector<trace_event> m_events;
+            std::atomic<std::uint64_t> m_written{0};
+            std::uint64_t m_read = 0; // by the flushing thread, under the lock of the registry
+            std::vector<trace_range> m_open;
+
+          public:
+            int const m_tid;
+
+            // the slot of the event being written is not read, it is the one after the `capacity` last events
+            trace_buffer(int tid, std::size_t capacity) : m_events(capacity + 1), m_tid(tid) {}
+
+            void begin(char const *name) { m_open.push_back({name, trace_clock::now()}); }
+
+            void end() {
+                if (m_open.empty())
+                    return;
+                auto now = trace_clock::now();
+                auto &range = m_open.back();
+                auto n = m_written.load(std::memory_order_relaxed);
+                auto &event = m_events[n % m_events.size()];
+                // the flushing thread that sees any of the following stores also sees that event n is being written
+                std::atomic_thread_fence(std::memory_order_release);
+                event.m_name.store(range.m_name, std::memory_order_relaxed);
+                event.m_begin.store(range.m_begin.time_since_epoch().count(), std::memory_order_relaxed);
+                event.m_duration.store((now - range.m_begin).count(), std::memory_order_relaxed);
+                m_written.store(n + 1, std::memory_order_release);
+                m_open.pop_back();
+            }
+
+            // the ranges left open by an exited thread are dropped, the buffer is reused by the next thread
+            void reset() { m_open.clear(); }
+
+            template <class Fun>
+            void drain(Fun &&fun) {
+                std::uint64_t capacity = m_events.size();
+                auto written = m_written.load(std::memory_order_acquire);
+                auto first = std::max(m_read, written > capacity ? written - capacity : 0);
+                std::vector<trace_range> ranges;
+                std::vector<trace_clock::duration> durations;
+                for (auto i = first; i != written; ++i) {
+                    auto &event = m_events[i % capacity];
+                    ranges.push_back({event.m_name.load(std::memory_order_relaxed),
+                        trace_clock::time_point(trace_clock::duration(event.m_begin.load(std::memory_order_relaxed)))});
+                    durations.emplace_back(event.m_duration.load(std::memory_order_relaxed));
+                }
+                std::atomic_thread_fence(std::memory_order_acquire);
+                // the events up to `overwritten` may have been overwritten while they were copied
+                auto current = m_written.load(std::memory_order_relaxed);
+                auto overwritten = current >= capacity ? current - capacity + 1 : 0;
+                for (auto i = std::max(first, overwritten); i != written; ++i)
+                    fun(ranges[i - first], durations[i - first]);
+                m_read = written;
+            }
+        };
+
+        std::size_t buffer_capacity() {
+            if (char const *env = std::getenv("GEN_TRACE_BUFFER_SIZE")) {
+                long res = std::atol(env);
+                if (res > 0)
+                    return res;
+            }
+            return 65536;
+        }
+
+        std::string file_name() {
+            char const *env = std::getenv("GEN_TRACE_FILE");
+            return env && *env ? env : "gen_trace.json";
+        }
+
+        void write_escaped(std::ostream &strm, char const *str) {
+            for (; *str; ++str) {
+                if (*str == '"' || *str == '\\')
+                    strm << '\\' << *str;
+                else if (static_cast<unsigned char>(*str) < 0x20) {
+                    char buf[8];
+                    std::snprintf(buf, sizeof buf, "\\u%04x", *str);
+                    strm << buf;
+                } else
+                    strm << *str;
+            }
+        }
+
+        void write_microseconds(std::ostream &strm, trace_clock::duration duration) {
+            auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+            strm << ns / 1000 << '.' << std::setw(3) << std::setfill('0') << ns % 1000;
+        }
+
+        void close_trace_file();
+
+        /**
+         * The buffers of all threads. It is never destroyed: the threads of the worker pools may still trace calls
+         * while the program exits. The file is completed by an atexit() handler, later events are dropped.
+         */
+        class trace_registry {
+            std::mutex m_mutex;
+            std::vector<std::unique_ptr<trace_buffer>> m_buffers;
+            std::vector<trace_buffer *> m_free;
+            std::unordered_set<std::string> m_names;
+            trace_clock::time_point m_start = trace_clock::now();
+            std::ofstream m_file;
+            bool m_first = true;
+            bool m_closed = false;
+
+            void flush_locked() {
+                if (m_closed)
+                    return;
+                if (!m_file.is_open()) {
+                    m_file.open(file_name());
+                    m_file << "[\n";
+                }
+                for (auto &&buffer : m_buffers) {
+                    int tid = buffer->m_tid;
+                    buffer->drain([&](trace_range const &range, trace_clock::duration duration) {
+                        if (!m_first)
+                            m_file << ",\n";
+                        m_first = false;
+                        m_file << "{\"ph\":\"X\",\"pid\":1,\"tid\":" << tid << ",\"ts\":";
+                        write_microseconds(m_file, range.m_begin - m_start);
+                        m_file << ",\"dur\":";
+                        write_microseconds(m_file, duration);
+                        m_file << ",\"name\":\"";
+                        write_escaped(m_file, range.m_name);
+                        m_file << "\"}";
+                    });
+                }
+                m_file.flush();
+            }
+
+          public:
+            trace_registry() { std::atexit(close_trace_file); }
+
+            void close() {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_buffers.empty() && !m_file.is_open())
+                    return;
+                flush_locked();
+                m_file << "\n]\n";
+                m_file.close();
+                m_closed = true;
+            }
+
+            trace_buffer *acquire_buffer() {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (!m_free.empty()) {
+                    auto res = m_free.back();
+                    m_free.pop_back();
+                    return res;
+                }
+                m_buffers.emplace_back(new trace_buffer(m_buffers.size(), buffer_capacity()));
+                return m_buffers.back().get();
+            }
+
+            void release_buffer(trace_buffer *buffer) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                buffer->reset();
+                m_free.push_back(buffer);
+            }
+
+            char const *intern(char const *name) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                return m_names.insert(name).first->c_str();
+            }
+
+            void flush() {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                flush_locked();
+            }
+        };
+
+        trace_registry &get_trace_registry() {
+            static trace_registry *obj = new trace_registry;
+            return *obj;
+        }
+
+        void close_trace_file() { get_trace_registry().close(); }
+
+        // the buffer of an exited thread is handed over to the next new thread
+        struct trace_buffer_owner {
+            trace_buffer *m_buffer = get_trace_registry().acquire_buffer();
+            ~trace_buffer_owner() { get_trace_registry().release_buffer(m_buffer); }
+        };
+
+        trace_buffer &get_trace_buffer() {
+            static thread_local trace_buffer_owner obj;
+            return *obj.m_buffer;
+        }
+    } // namespace
+
+    void trace_begin_static(char const *name) { get_trace_buffer().begin(name); }
+} // namespace cpp_bindgen
+
+void gen_trace_begin(char const *name) {
+    static thread_local std::unordered_map<std::string, char const *> names;
+    auto &interned = names[name];
+    if (!interned)
+        interned = cpp_bindgen::get_trace_registry().intern(name);
+    cpp_bindgen::trace_begin_static(interned);
+}
+
+void gen_trace_end() { cpp_bindgen::get_trace_buffer().end(); }
+
+void gen_trace_flush() { cpp_bindgen::get_trace_registry().flush(); }
@@ -0,0 +1,28 @@
+! GridTools
+!
+! Copyright (c) 2014-2019, ETH Zurich
+! All rights reserved.
+!
+! Please, refer to the LICENSE file in the root directory.
+! SPDX-License-Identifier: BSD-3-Clause
+
+module gen_trace
+    implicit none
+    interface
+        subroutine gen_trace_begin_impl(name) bind(c, name="gen_trace_begin")
+            use iso_c_binding
+            character(kind=c_char), dimension(*) :: name
+        end
+        subroutine gen_trace_end() bind(c)
+        end
+        subroutine gen_trace_flush() bind(c)
+        end
+    end interface
+contains
+    subroutine gen_trace_begin(name)
+        use iso_c_binding
+        character(*), intent(in) :: name
+
+        call gen_trace_begin_impl(trim(name) // c_null_char)
+    end
+end
@@ -0,0 +1,37 @@
+! GridTools
+!
+! Copyright (c) 2014-2019, ETH Zurich
+! All rights reserved.
+!
+! Please, refer to the LICENSE file in the root directory.
+! SPDX-License-Identifier: BSD-3-Clause
+
+program main
+    use iso_c_binding
+    use gen_handle
+    use gen_async
+    use gen_regression_async
+    implicit none
+    real(c_double), dimension(3, 4) :: field
+    real(c_double), dimension(3, 6) :: big_field
+    type(c_ptr) :: future, res
+
+    field = 1
+
+    call gen_set_async_num_threads(2)
+    future = async_scale_and_sum(field, 2._c_double)
+    res = gen_wait(future)
+    if (.not. gen_test(future)) stop 1
+    call gen_release(future)
+
+    if (accumulated_value(res) /= 24) stop 2
+    call gen_release(res)
+    if (any(field /= 2)) stop 3
+
+    ! contiguous sections are passed without a copy
+    big_field = 1
+    future = async_scale_and_sum(big_field(:, 3:6), 2._c_double)
+    call gen_release(gen_wait(future))
+    call gen_release(future)
+    if (any(big_field(:, 3:6) /= 2) .or. any(big_field(:, 1:2) /= 1)) stop 4
+end
@@ -0,0 +1,24 @@
+! GridTools
+!
+! Copyright (c) 2014-2019, ETH Zurich
+! All rights reserved.
+!
+! Please, refer to the LICENSE file in the root directory.
+! SPDX-License-Identifier: BSD-3-Clause
+
+! the wrapper of an asynchronous binding stops the program if an array section is not contiguous
+program main
+    use iso_c_binding
+    use gen_handle
+    use gen_async
+    use gen_regression_async
+    implicit none
+    real(c_double), dimension(6, 4) :: field
+    type(c_ptr) :: future
+
+    field = 1
+
+    future = async_scale_and_sum(field(::2, :), 2._c_double)
+    call gen_release(gen_wait(future))
+    call gen_release(future)
+end
@@ -0,0 +1,31 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cpp_bindgen/export.hpp>
+
+namespace {
+    struct accumulator {
+        double value;
+    };
+
+    accumulator scale_and_sum_impl(double (&field)[4][3], double factor) {
+        accumulator res = {0};
+        for (auto &&row : field)
+            for (auto &&elem : row) {
+                elem *= factor;
+                res.value += elem;
+            }
+        return res;
+    }
+    GEN_EXPORT_ASYNC_BINDING_WRAPPED(2, async_scale_and_sum, scale_and_sum_impl);
+
+    GEN_EXPORT_BINDING_WITH_SIGNATURE_1(
+        accumulated_value, double(accumulator const &), [](accumulator const &obj) { return obj.value; });
+} // namespace
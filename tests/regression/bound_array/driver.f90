@@ -0,0 +1,35 @@
+! GridTools
+!
+! Copyright (c) 2014-2019, ETH Zurich
+! All rights reserved.
+!
+! Please, refer to the LICENSE file in the root directory.
+! SPDX-License-Identifier: BSD-3-Clause
+
+program main
+    use iso_c_binding
+    use gen_handle
+    use gen_bound_array
+    use gen_regression_bound_array
+    implicit none
+    real(c_float), dimension(:, :), allocatable :: field
+    type(c_ptr) :: bound
+    integer :: step
+
+    allocate(field(3, 4))
+    field = 0
+    bound = gen_bind_array(field)
+    DO step=1, 3
+        call gen_rebind_array(bound, field)
+        call increment(bound)
+    END DO
+    if (any(field /= 3)) stop 1
+
+    deallocate(field)
+    allocate(field(3, 4))
+    field = 10
+    call gen_rebind_array(bound, field)
+    call increment(bound)
+    if (any(field /= 11)) stop 2
+    call gen_release(bound)
+end
@@ -0,0 +1,23 @@
+! GridTools
+!
+! Copyright (c) 2014-2019, ETH Zurich
+! All rights reserved.
+!
+! Please, refer to the LICENSE file in the root directory.
+! SPDX-License-Identifier: BSD-3-Clause
+
+! a strided section can not be bound, the handle would see the elements in between
+program main
+    use iso_c_binding
+    use gen_handle
+    use gen_bound_array
+    use gen_regression_bound_array
+    implicit none
+    real(c_float), dimension(6, 4) :: field
+    type(c_ptr) :: bound
+
+    field = 0
+    bound = gen_bind_array(field(::2, :))
+    call increment(bound)
+    call gen_release(bound)
+end
@@ -0,0 +1,20 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cpp_bindgen/export.hpp>
+
+namespace {
+    void increment_impl(cpp_bindgen::bound_array<float (&)[4][3]> field) {
+        for (auto &&row : field.get())
+            for (auto &&elem : row)
+                ++elem;
+    }
+    GEN_EXPORT_BINDING_1(increment, increment_impl);
+} // namespace
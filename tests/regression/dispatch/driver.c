@@ -0,0 +1,37 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "gen_regression_dispatch_dispatch.h"
+
+// dispatch_scale multiplies by 2 in the library given first, by 3 in the alternative build given second
+int main(int argc, char *argv[]) {
+    struct gen_regression_dispatch_dispatch lib = {0}, alternative = {0};
+    if (argc != 3 || !gen_regression_dispatch_load(&lib, argv[1]) ||
+        !gen_regression_dispatch_load(&alternative, argv[2]))
+        return 1;
+
+    double field[4][3];
+    gen_fortran_array_descriptor descriptor = {gen_fk_Double, 2, {3, 4}, &field[0][0]};
+    lib.dispatch_fill(&descriptor, 5);
+    gen_handle *obj = lib.dispatch_make(field[3][2]);
+    int ok = lib.dispatch_value(obj) == 5 && lib.dispatch_twice0(3) == 6 && lib.dispatch_twice1(1.5) == 3;
+    gen_release(obj);
+    ok = ok && lib.dispatch_scale(1) == 2 && alternative.dispatch_scale(1) == 3;
+
+    // loading again replaces the library, a failed load keeps it
+    ok = ok && gen_regression_dispatch_load(&lib, argv[2]) && lib.dispatch_scale(1) == 3;
+    ok = ok && !gen_regression_dispatch_load(&lib, "libgen_regression_dispatch_missing.so") &&
+         lib.dispatch_scale(1) == 3;
+    gen_regression_dispatch_unload(&lib);
+    gen_regression_dispatch_unload(&alternative);
+
+    ok = ok && !gen_regression_dispatch_load(&lib, "libgen_regression_dispatch_missing.so") && gen_dispatch_error();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,42 @@
+! GridTools
+!
+! Copyright (c) 2014-2019, ETH Zurich
+! All rights reserved.
+!
+! Please, refer to the LICENSE file in the root directory.
+! SPDX-License-Identifier: BSD-3-Clause
+
+program main
+    use iso_c_binding
+    use gen_handle
+    use gen_regression_dispatch_dispatch
+    implicit none
+    character(4096) :: library, alternative
+    real(c_double), dimension(3, 4) :: field
+    type(c_ptr) :: obj
+
+    call get_command_argument(1, library)
+    call get_command_argument(2, alternative)
+
+    if (associated(dispatch_scale)) stop 1
+    if (.not. gen_regression_dispatch_load(library)) stop 2
+
+    call dispatch_fill(field, 5._c_double)
+    if (any(field /= 5)) stop 3
+    obj = dispatch_make(field(3, 4))
+    if (dispatch_value(obj) /= 5) stop 4
+    call gen_release(obj)
+    if (dispatch_twice(3) /= 6 .or. dispatch_twice(1.5_c_double) /= 3) stop 5
+    if (dispatch_scale(1._c_double) /= 2) stop 6
+
+    ! the alternative build replaces the library
+    if (.not. gen_regression_dispatch_load(alternative)) stop 7
+    if (dispatch_scale(1._c_double) /= 3) stop 8
+
+    ! a failed load keeps the library loaded before
+    if (gen_regression_dispatch_load("libgen_regression_dispatch_missing.so")) stop 9
+    if (dispatch_scale(1._c_double) /= 3) stop 10
+
+    call gen_regression_dispatch_unload()
+    if (associated(dispatch_scale)) stop 11
+end
@@ -0,0 +1,43 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cpp_bindgen/export.hpp>
+
+#ifndef GEN_REGRESSION_DISPATCH_FACTOR
+#define GEN_REGRESSION_DISPATCH_FACTOR 2
+#endif
+
+namespace {
+    double scale_impl(double x) { return GEN_REGRESSION_DISPATCH_FACTOR * x; }
+    GEN_EXPORT_BINDING_1(dispatch_scale, scale_impl);
+
+    void fill_impl(double (&field)[4][3], double value) {
+        for (auto &&row : field)
+            for (auto &&elem : row)
+                elem = value;
+    }
+    GEN_EXPORT_BINDING_WRAPPED_2(dispatch_fill, fill_impl);
+
+    struct accumulator {
+        double value;
+    };
+
+    accumulator make_impl(double value) { return {value}; }
+    GEN_EXPORT_BINDING_1(dispatch_make, make_impl);
+
+    GEN_EXPORT_BINDING_WITH_SIGNATURE_1(
+        dispatch_value, double(accumulator const &), [](accumulator const &obj) { return obj.value; });
+
+    template <class T>
+    T twice_impl(T x) {
+        return 2 * x;
+    }
+    GEN_EXPORT_GENERIC_BINDING(1, dispatch_twice, twice_impl, (int)(double));
+} // namespace
@@ -0,0 +1,31 @@
+! GridTools
+!
+! Copyright (c) 2014-2019, ETH Zurich
+! All rights reserved.
+!
+! Please, refer to the LICENSE file in the root directory.
+! SPDX-License-Identifier: BSD-3-Clause
+
+program main
+    use iso_c_binding
+    use gen_regression_elemental
+    implicit none
+    integer, parameter :: ie = 9, je = 10, ke = 11
+    integer :: i, j, k
+    real(c_double), dimension(ie, je, ke) :: t, p, theta, expected
+
+    DO i=1, ie
+        DO j=1, je
+            DO k=1, ke
+                t(i,j,k) = 200 + i + j + k
+                p(i,j,k) = 1000 * k
+                expected(i,j,k) = potential_temperature(t(i,j,k), p(i,j,k))
+            END DO
+        END DO
+    END DO
+
+    theta = potential_temperature(t, p)
+    if (any(theta /= expected)) stop 1
+
+    if (any(potential_temperature(t(:,1,1), p(:,1,1)) /= expected(:,1,1))) stop 2
+end
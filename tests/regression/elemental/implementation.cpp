@@ -0,0 +1,17 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cpp_bindgen/export.hpp>
+
+namespace {
+    double potential_temperature_impl(double t, double p) { return t * (100000. / p); }
+
+    GEN_EXPORT_ELEMENTAL_BINDING(2, potential_temperature, potential_temperature_impl);
+} // namespace
@@ -0,0 +1,28 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cpp_bindgen/async.h>
+
+#include "gen_regression_generator_tool.h"
+
+int main() {
+    double field[4][3];
+    for (int i = 0; i < 4; ++i)
+        for (int j = 0; j < 3; ++j)
+            field[i][j] = 1;
+    gen_fortran_array_descriptor descriptor = {gen_fk_Double, 2, {3, 4}, &field[0][0]};
+
+    gen_handle *future = async_scale_and_sum(&descriptor, 2);
+    gen_handle *res = gen_wait(future);
+    gen_release(future);
+    int ok = accumulated_value(res) == 24 && field[3][2] == 2;
+    gen_release(res);
+    return ok ? 0 : 1;
+}
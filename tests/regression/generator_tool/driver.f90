@@ -0,0 +1,29 @@
+! GridTools
+!
+! Copyright (c) 2014-2019, ETH Zurich
+! All rights reserved.
+!
+! Please, refer to the LICENSE file in the root directory.
+! SPDX-License-Identifier: BSD-3-Clause
+
+program main
+    use iso_c_binding
+    use gen_handle
+    use gen_async
+    use gen_regression_generator_tool
+    implicit none
+    real(c_double), dimension(3, 4) :: field
+    type(c_ptr) :: future, res
+
+    field = 1
+
+    call gen_set_async_num_threads(2)
+    future = async_scale_and_sum(field, 2._c_double)
+    res = gen_wait(future)
+    if (.not. gen_test(future)) stop 1
+    call gen_release(future)
+
+    if (accumulated_value(res) /= 24) stop 2
+    call gen_release(res)
+    if (any(field /= 2)) stop 3
+end
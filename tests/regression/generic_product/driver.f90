@@ -0,0 +1,29 @@
+! GridTools
+!
+! Copyright (c) 2014-2019, ETH Zurich
+! All rights reserved.
+!
+! Please, refer to the LICENSE file in the root directory.
+! SPDX-License-Identifier: BSD-3-Clause
+
+program main
+    use iso_c_binding
+    use gen_regression_generic_product
+    implicit none
+    real(c_float), dimension(5) :: a1
+    real(c_double), dimension(4, 3) :: a2
+    real(c_float), dimension(2, 3, 4) :: a3
+
+    a1 = 1
+    a2 = 1
+    a3 = 1
+
+    ! the specialization is selected by type, kind and rank, each one scales by its rank
+    call scale(a1, 2.0_c_float)
+    call scale(a2, 2.0_c_double)
+    call scale(a3, 2.0_c_float)
+
+    if (any(a1 /= 2)) stop 1
+    if (any(a2 /= 4)) stop 1
+    if (any(a3 /= 6)) stop 1
+end
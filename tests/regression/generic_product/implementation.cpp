@@ -0,0 +1,43 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+#include <cpp_bindgen/export.hpp>
+
+namespace {
+    template <class T, int Rank>
+    struct field {
+        using gen_view_element_type = T;
+        using gen_view_rank = std::integral_constant<int, Rank>;
+        using gen_is_acc_present = std::false_type;
+
+        T *data;
+        std::size_t size;
+
+        field(gen_fortran_array_descriptor const &descriptor)
+            : data(static_cast<T *>(descriptor.data)), size(1) {
+            if (descriptor.type != cpp_bindgen::fortran_array_element_kind<T>::value || descriptor.rank != Rank)
+                throw std::runtime_error("field type does not match");
+            for (int i = 0; i < Rank; ++i)
+                size *= descriptor.dims[i];
+        }
+    };
+
+    template <class T, int Rank>
+    void scale_impl(field<T, Rank> f, T factor) {
+        for (std::size_t i = 0; i < f.size; ++i)
+            f.data[i] *= factor * Rank;
+    }
+
+    GEN_EXPORT_GENERIC_BINDING_PRODUCT_WRAPPED(2, scale, scale_impl, (float)(double), 1, 3);
+} // namespace
@@ -0,0 +1,20 @@
+! GridTools
+!
+! Copyright (c) 2014-2019, ETH Zurich
+! All rights reserved.
+!
+! Please, refer to the LICENSE file in the root directory.
+! SPDX-License-Identifier: BSD-3-Clause
+
+program main
+    use iso_c_binding
+    use gen_regression_ipo
+    implicit none
+    real(c_double), dimension(3, 4) :: field
+
+    if (axpy(2._c_double, 3._c_double, 1._c_double) /= 7) stop 1
+
+    field = 1
+    call scale(field, 2._c_double)
+    if (any(field /= 2)) stop 2
+end
@@ -0,0 +1,18 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cpp_bindgen/export.hpp>
+
+// defined in another translation unit, they are only inlined into the generated functions at link time
+double axpy_impl(double a, double x, double y);
+void scale_impl(double (&field)[4][3], double factor);
+
+GEN_EXPORT_BINDING_3(axpy, axpy_impl);
+GEN_EXPORT_BINDING_WRAPPED_2(scale, scale_impl);
@@ -0,0 +1,17 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+double axpy_impl(double a, double x, double y) { return a * x + y; }
+
+void scale_impl(double (&field)[4][3], double factor) {
+    for (auto &&row : field)
+        for (auto &&elem : row)
+            elem *= factor;
+}
@@ -0,0 +1,35 @@
+! GridTools
+!
+! Copyright (c) 2014-2019, ETH Zurich
+! All rights reserved.
+!
+! Please, refer to the LICENSE file in the root directory.
+! SPDX-License-Identifier: BSD-3-Clause
+
+program main
+    use iso_c_binding
+    use gen_queue
+    use gen_regression_queue
+    implicit none
+    real(c_double), dimension(3, 4) :: a, b, c
+
+    a = 0
+    b = 0
+    c = 0
+
+    call gen_queue_begin()
+    call set_field(a, 1._c_double)
+    call set_field(c, 5._c_double)
+    call apply_stencil(b, a)
+    if (any(a /= 0) .or. any(b /= 0) .or. any(c /= 0)) stop 1
+    call gen_queue_flush_parallel()
+
+    if (any(a /= 1) .or. any(c /= 5)) stop 2
+    if (any(b(1, :) /= 1) .or. any(b(2:, :) /= 2)) stop 3
+
+    ! calls returning a value execute the recorded calls first
+    call gen_queue_begin()
+    call set_field(a, 2._c_double)
+    if (field_sum(a) /= 24) stop 4
+    call gen_queue_flush()
+end
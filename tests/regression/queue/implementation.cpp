@@ -0,0 +1,36 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cpp_bindgen/export.hpp>
+
+namespace {
+    void set_field_impl(double (&field)[4][3], double value) {
+        for (auto &&row : field)
+            for (auto &&elem : row)
+                elem = value;
+    }
+    GEN_EXPORT_BINDING_WRAPPED_2(set_field, set_field_impl);
+
+    void apply_stencil_impl(double (&out)[4][3], double const (&in)[4][3]) {
+        for (int i = 0; i < 4; ++i)
+            for (int j = 0; j < 3; ++j)
+                out[i][j] = in[i][j] + (j > 0 ? in[i][j - 1] : 0);
+    }
+    GEN_EXPORT_BINDING_WRAPPED_2(apply_stencil, apply_stencil_impl);
+
+    double field_sum_impl(double const (&field)[4][3]) {
+        double res = 0;
+        for (auto &&row : field)
+            for (auto &&elem : row)
+                res += elem;
+        return res;
+    }
+    GEN_EXPORT_BINDING_WRAPPED_1(field_sum, field_sum_impl);
+} // namespace
@@ -0,0 +1,52 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+
+#include "gen_regression_restrict.h"
+
+static int check(int ok, char const *what) {
+    if (!ok)
+        printf("%s failed\n", what);
+    return ok ? 0 : 1;
+}
+
+int main() {
+    int errors = 0;
+    int n = 3, m = 2, k = 4;
+
+    double const x[] = {1, 2, 3};
+    double y[] = {1, 1, 1};
+    axpy(n, 2, x, y);
+    errors += check(y[0] == 3 && y[2] == 7, "axpy");
+
+    double const a = 3, b = 4;
+    errors += check(dot(&a, &b) == 12, "dot");
+
+    float src[m][n], dst[n][m];
+    for (int i = 0; i < m; ++i)
+        for (int j = 0; j < n; ++j)
+            src[i][j] = 10 * i + j;
+    gen_fortran_array_descriptor dst_descriptor = GEN_C_ARRAY_DESCRIPTOR2(dst);
+    gen_fortran_array_descriptor src_descriptor = GEN_C_ARRAY_DESCRIPTOR2(src);
+    transpose(&dst_descriptor, &src_descriptor);
+    errors += check(dst[2][1] == 12 && dst[1][0] == 1, "transpose");
+
+    float field[m][n][k];
+    for (int i = 0; i < m; ++i)
+        for (int j = 0; j < n; ++j)
+            for (int l = 0; l < k; ++l)
+                field[i][j][l] = 1;
+    gen_fortran_array_descriptor field_descriptor = GEN_C_ARRAY_DESCRIPTOR3(field);
+    scale(&field_descriptor, 2);
+    errors += check(field[0][0][0] == 2 && field[1][2][3] == 2, "scale");
+
+    return errors;
+}
@@ -0,0 +1,38 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cpp_bindgen/export.hpp>
+
+namespace {
+    void axpy_impl(int n, double a, double const *x, double *y) {
+        for (int i = 0; i < n; ++i)
+            y[i] += a * x[i];
+    }
+    GEN_EXPORT_BINDING_4(axpy, axpy_impl);
+
+    double dot_impl(double const &a, double const &b) noexcept { return a * b; }
+    GEN_EXPORT_BINDING_2(dot, dot_impl);
+
+    template <class T>
+    void transpose_impl(T (&dst)[3][2], T const (&src)[2][3]) {
+        for (int i = 0; i < 2; ++i)
+            for (int j = 0; j < 3; ++j)
+                dst[j][i] = src[i][j];
+    }
+    GEN_EXPORT_BINDING_WRAPPED(2, transpose, transpose_impl<float>);
+
+    void scale_impl(float (&field)[2][3][4], float factor) {
+        for (auto &plane : field)
+            for (auto &row : plane)
+                for (auto &elem : row)
+                    elem *= factor;
+    }
+    GEN_EXPORT_BINDING_WRAPPED(2, scale, scale_impl);
+} // namespace
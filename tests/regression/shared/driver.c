@@ -0,0 +1,32 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <dlfcn.h>
+
+#include "gen_regression_shared.h"
+
+int main() {
+    double field[4][3];
+    for (int i = 0; i < 4; ++i)
+        for (int j = 0; j < 3; ++j)
+            field[i][j] = 1;
+    gen_fortran_array_descriptor descriptor = {gen_fk_Double, 2, {3, 4}, &field[0][0]};
+
+    gen_handle *res = twice_sum(&descriptor);
+    int ok = accumulated_value(res) == 24;
+    gen_release(res);
+
+    // only the bindings are exported by the library
+    void *self = dlopen(0, RTLD_NOW);
+    ok = ok && dlsym(self, "twice_sum") && dlsym(self, "accumulated_value") &&
+         !dlsym(self, "gen_regression_shared_helper");
+    dlclose(self);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,22 @@
+! GridTools
+!
+! Copyright (c) 2014-2019, ETH Zurich
+! All rights reserved.
+!
+! Please, refer to the LICENSE file in the root directory.
+! SPDX-License-Identifier: BSD-3-Clause
+
+program main
+    use iso_c_binding
+    use gen_handle
+    use gen_regression_shared
+    implicit none
+    real(c_double), dimension(3, 4) :: field
+    type(c_ptr) :: res
+
+    field = 1
+
+    res = twice_sum(field)
+    if (accumulated_value(res) /= 24) stop 1
+    call gen_release(res)
+end
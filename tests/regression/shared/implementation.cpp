@@ -0,0 +1,32 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cpp_bindgen/export.hpp>
+
+// not a binding: hidden in the shared library
+extern "C" double gen_regression_shared_helper(double x) { return 2 * x; }
+
+namespace {
+    struct accumulator {
+        double value;
+    };
+
+    accumulator sum_impl(double (&field)[4][3]) {
+        accumulator res = {0};
+        for (auto &&row : field)
+            for (auto &&elem : row)
+                res.value += gen_regression_shared_helper(elem);
+        return res;
+    }
+    GEN_EXPORT_BINDING_WRAPPED_1(twice_sum, sum_impl);
+
+    GEN_EXPORT_BINDING_WITH_SIGNATURE_1(
+        accumulated_value, double(accumulator const &), [](accumulator const &obj) { return obj.value; });
+} // namespace
@@ -0,0 +1,25 @@
+! GridTools
+!
+! Copyright (c) 2014-2019, ETH Zurich
+! All rights reserved.
+!
+! Please, refer to the LICENSE file in the root directory.
+! SPDX-License-Identifier: BSD-3-Clause
+
+program main
+    use iso_c_binding
+    use gen_regression_submodules
+    implicit none
+    real(c_double), dimension(3, 4) :: field
+    real(c_double), dimension(5) :: t, p, theta
+
+    field = 1
+    call scale(field, 2._c_double)
+    if (any(field /= 2)) stop 1
+    if (field_sum(field) /= 24) stop 2
+
+    t = 300
+    p = 50000
+    theta = potential_temperature(t, p)
+    if (any(theta /= 600)) stop 3
+end
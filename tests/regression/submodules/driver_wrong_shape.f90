@@ -0,0 +1,18 @@
+! GridTools
+!
+! Copyright (c) 2014-2019, ETH Zurich
+! All rights reserved.
+!
+! Please, refer to the LICENSE file in the root directory.
+! SPDX-License-Identifier: BSD-3-Clause
+
+! the array is smaller than the static extents of the binding, the call must not read or write past its end
+program main
+    use iso_c_binding
+    use gen_regression_submodules
+    implicit none
+    real(c_double), dimension(3, 3) :: field
+
+    field = 1
+    call scale(field, 2._c_double)
+end
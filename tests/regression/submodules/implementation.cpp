@@ -0,0 +1,32 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cpp_bindgen/export.hpp>
+
+namespace {
+    double potential_temperature_impl(double t, double p) { return t * (100000. / p); }
+    GEN_EXPORT_ELEMENTAL_BINDING(2, potential_temperature, potential_temperature_impl);
+
+    void scale_impl(double (&field)[4][3], double factor) {
+        for (auto &&row : field)
+            for (auto &&elem : row)
+                elem *= factor;
+    }
+    GEN_EXPORT_BINDING_WRAPPED_2(scale, scale_impl);
+
+    double sum_impl(double (&field)[4][3]) {
+        double res = 0;
+        for (auto &&row : field)
+            for (auto &&elem : row)
+                res += elem;
+        return res;
+    }
+    GEN_EXPORT_BINDING_WRAPPED_1(field_sum, sum_impl);
+} // namespace
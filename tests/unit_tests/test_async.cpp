@@ -0,0 +1,210 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cpp_bindgen/export.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <cpp_bindgen/async.h>
+#include <cpp_bindgen/handle.h>
+
+namespace {
+    using vector_t = std::vector<double>;
+
+    std::atomic<bool> released{false};
+
+    vector_t make_impl(int size, double val) {
+        while (!released)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        return vector_t(size, val);
+    }
+    GEN_EXPORT_ASYNC_BINDING(2, async_make, make_impl);
+
+    GEN_EXPORT_BINDING_WITH_SIGNATURE_1(size, int(vector_t const &), [](vector_t const &obj) { return obj.size(); });
+
+    void fill_impl(int (&arr)[2][3], int val) {
+        for (auto &&row : arr)
+            for (auto &&elem : row)
+                elem = val;
+    }
+    GEN_EXPORT_ASYNC_BINDING_WRAPPED(2, async_fill, fill_impl);
+
+    GEN_EXPORT_ASYNC_BINDING_WITH_SIGNATURE(0, async_fail, void(), [] { throw std::runtime_error("failure"); });
+
+    std::atomic<bool> copy_released{false};
+
+    vector_t copy_impl(double const &val, gen_fortran_array_descriptor const &descriptor) {
+        while (!copy_released)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        return vector_t(descriptor.dims[0], val);
+    }
+    GEN_EXPORT_ASYNC_BINDING(2, async_copy, copy_impl);
+
+    TEST(async, result) {
+        gen_set_async_num_threads(2);
+        gen_handle *future = async_make(3, 42);
+        EXPECT_FALSE(gen_test(future));
+        released = true;
+        gen_handle *obj = gen_wait(future);
+        EXPECT_TRUE(gen_test(future));
+        ASSERT_TRUE(obj);
+        EXPECT_EQ(3, size(obj));
+        gen_release(obj);
+        gen_release(future);
+    }
+
+    TEST(async, void_result) {
+        int arr[2][3] = {};
+        gen_fortran_array_descriptor descriptor;
+        descriptor.type = gen_fk_Int;
+        descriptor.rank = 2;
+        descriptor.dims[0] = 3;
+        descriptor.dims[1] = 2;
+        descriptor.data = arr;
+        descriptor.is_acc_present = false;
+        gen_handle *future = async_fill(&descriptor, 5);
+        EXPECT_EQ(nullptr, gen_wait(future));
+        gen_release(future);
+        for (auto &&row : arr)
+            for (auto &&elem : row)
+                EXPECT_EQ(5, elem);
+    }
+
+    TEST(async, exception) {
+        gen_handle *future = async_fail();
+        EXPECT_THROW(gen_wait(future), std::runtime_error);
+        gen_release(future);
+    }
+
+    TEST(async, arguments_are_copied) {
+        double val = 1;
+        gen_fortran_array_descriptor descriptor = {gen_fk_Double, 1, {2, 0, 0, 0, 0, 0, 0}, nullptr, false};
+        gen_handle *future = async_copy(&val, &descriptor);
+        // the generated function has returned, the temporaries of the caller may be gone
+        val = 2;
+        descriptor.dims[0] = 3;
+        copy_released = true;
+        gen_handle *obj = gen_wait(future);
+        ASSERT_TRUE(obj);
+        EXPECT_EQ(vector_t({1, 1}), cpp_bindgen::any_cast<vector_t &>(obj->m_value));
+        gen_release(obj);
+        gen_release(future);
+    }
+
+    const char expected_c_interface[] = R"?(// This file is generated!
+#pragma once
+
+#include <cpp_bindgen/array_descriptor.h>
+#include <cpp_bindgen/c_attributes.h>
+#include <cpp_bindgen/handle.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Asynchronous: returns a future handle immediately, the result is obtained with gen_wait(future).
+// Arrays, pointers and handles passed as arguments must stay valid until gen_wait(future) has returned.
+gen_handle* async_copy(double const*, gen_fortran_array_descriptor*) GEN_NONNULL(1, 2);
+// Asynchronous: returns a future handle immediately, the result is obtained with gen_wait(future).
+// Arrays, pointers and handles passed as arguments must stay valid until gen_wait(future) has returned.
+gen_handle* async_fail();
+// Asynchronous: returns a future handle immediately, the result is obtained with gen_wait(future).
+// Arrays, pointers and handles passed as arguments must stay valid until gen_wait(future) has returned.
+gen_handle* async_fill(gen_fortran_array_descriptor*, int) GEN_NONNULL(1);
+// Asynchronous: returns a future handle immediately, the result is obtained with gen_wait(future).
+// Arrays, pointers and handles passed as arguments must stay valid until gen_wait(future) has returned.
+gen_handle* async_make(int, double);
+int size(gen_handle*) GEN_NONNULL(1);
+
+#ifdef __cplusplus
+}
+#endif
+)?";
+
+    TEST(async, c_interface) {
+        std::ostringstream strm;
+        cpp_bindgen::generate_c_interface(strm);
+        EXPECT_EQ(strm.str(), expected_c_interface);
+    }
+
+    const char expected_fortran_interface[] = R"?(! This file is generated!
+module my_module
+implicit none
+  interface
+
+    ! Asynchronous: returns a future handle immediately, the result is obtained with gen_wait(future).
+    ! Arrays, pointers and handles passed as arguments must stay valid until gen_wait(future) has returned.
+    type(c_ptr) function async_copy(arg0, arg1) bind(c)
+      use iso_c_binding
+      use gen_array_descriptor
+      real(c_double), dimension(*), intent(in) :: arg0
+      type(gen_fortran_array_descriptor) :: arg1
+    end function
+    ! Asynchronous: returns a future handle immediately, the result is obtained with gen_wait(future).
+    ! Arrays, pointers and handles passed as arguments must stay valid until gen_wait(future) has returned.
+    type(c_ptr) function async_fail() bind(c)
+      use iso_c_binding
+    end function
+    type(c_ptr) function async_fill_impl(arg0, arg1) bind(c, name="async_fill")
+      use iso_c_binding
+      use gen_array_descriptor
+      type(gen_fortran_array_descriptor) :: arg0
+      integer(c_int), value :: arg1
+    end function
+    ! Asynchronous: returns a future handle immediately, the result is obtained with gen_wait(future).
+    ! Arrays, pointers and handles passed as arguments must stay valid until gen_wait(future) has returned.
+    type(c_ptr) function async_make(arg0, arg1) bind(c)
+      use iso_c_binding
+      integer(c_int), value :: arg0
+      real(c_double), value :: arg1
+    end function
+    integer(c_int) function size(arg0) bind(c)
+      use iso_c_binding
+      type(c_ptr), value :: arg0
+    end function
+
+  end interface
+contains
+    ! Asynchronous: returns a future handle immediately, the result is obtained with gen_wait(future).
+    ! Arrays, pointers and handles passed as arguments must stay valid until gen_wait(future) has returned.
+    type(c_ptr) function async_fill(arg0, arg1)
+      use iso_c_binding
+      use gen_array_descriptor
+      integer(c_int), dimension(:,:), intent(inout), target :: arg0
+      integer(c_int), value :: arg1
+      type(gen_fortran_array_descriptor) :: descriptor0
+
+      if (.not. is_contiguous(arg0)) error stop "async_fill: arg0 is not contiguous"
+      if (any(shape(arg0) /= (/3, 2/))) error stop "async_fill: arg0 has the wrong shape"
+
+      descriptor0%rank = 2
+      descriptor0%type = 1
+      descriptor0%dims = reshape(shape(arg0), &
+        shape(descriptor0%dims), (/0/))
+      descriptor0%data = c_loc(arg0(lbound(arg0, 1),lbound(arg0, 2)))
+
+      async_fill = async_fill_impl(descriptor0, arg1)
+    end function
+end
+)?";
+
+    TEST(async, fortran_interface) {
+        std::ostringstream strm;
+        cpp_bindgen::generate_fortran_interface(strm, "my_module");
+        EXPECT_EQ(strm.str(), expected_fortran_interface);
+    }
+} // namespace
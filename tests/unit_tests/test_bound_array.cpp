@@ -0,0 +1,135 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cpp_bindgen/export.hpp>
+
+#include <sstream>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include <cpp_bindgen/bound_array.h>
+#include <cpp_bindgen/handle.h>
+
+namespace {
+    int created_views = 0;
+
+    struct counting_view {
+        double *m_data;
+        int m_size;
+    };
+
+    counting_view gen_make_fortran_array_view(gen_fortran_array_descriptor *descriptor, counting_view *) {
+        if (descriptor->rank != 1)
+            throw std::runtime_error("rank mismatch");
+        ++created_views;
+        return {static_cast<double *>(descriptor->data), descriptor->dims[0]};
+    }
+
+    double sum_impl(cpp_bindgen::bound_array<counting_view> field) {
+        double res = 0;
+        for (int i = 0; i < field.get().m_size; ++i)
+            res += field.get().m_data[i];
+        return res;
+    }
+    GEN_EXPORT_BINDING_1(sum, sum_impl);
+
+    void scale_impl(cpp_bindgen::bound_array<double (&)[2][3]> field, double factor) {
+        for (auto &&row : field.get())
+            for (auto &&elem : row)
+                elem *= factor;
+    }
+    GEN_EXPORT_BINDING_2(scale, scale_impl);
+
+    gen_fortran_array_descriptor make_descriptor(gen_fortran_array_kind type, int rank, int n, void *data) {
+        gen_fortran_array_descriptor descriptor;
+        descriptor.type = type;
+        descriptor.rank = rank;
+        descriptor.dims[0] = n;
+        descriptor.dims[1] = 2;
+        descriptor.data = data;
+        descriptor.is_acc_present = false;
+        return descriptor;
+    }
+
+    TEST(bound_array, view_is_created_once) {
+        double data[4] = {1, 2, 3, 4};
+        auto descriptor = make_descriptor(gen_fk_Double, 1, 4, data);
+        created_views = 0;
+        gen_handle *bound = gen_bind_array(&descriptor);
+        EXPECT_EQ(0, created_views);
+        EXPECT_EQ(10, sum(bound));
+        EXPECT_EQ(10, sum(bound));
+        EXPECT_EQ(1, created_views);
+
+        gen_rebind_array(bound, &descriptor);
+        EXPECT_EQ(10, sum(bound));
+        EXPECT_EQ(1, created_views);
+
+        descriptor.dims[0] = 3;
+        gen_rebind_array(bound, &descriptor);
+        EXPECT_EQ(6, sum(bound));
+        EXPECT_EQ(2, created_views);
+
+        double other[2] = {5, 6};
+        descriptor = make_descriptor(gen_fk_Double, 1, 2, other);
+        gen_rebind_array(bound, &descriptor);
+        EXPECT_EQ(11, sum(bound));
+        EXPECT_EQ(3, created_views);
+        gen_release(bound);
+    }
+
+    TEST(bound_array, c_array) {
+        double data[2][3] = {{1, 2, 3}, {4, 5, 6}};
+        auto descriptor = make_descriptor(gen_fk_Double, 2, 3, data);
+        gen_handle *bound = gen_bind_array(&descriptor);
+        scale(bound, 2);
+        scale(bound, 3);
+        EXPECT_EQ(6, data[0][0]);
+        EXPECT_EQ(36, data[1][2]);
+        gen_release(bound);
+    }
+
+    TEST(bound_array, validation) {
+        double data[6] = {};
+        auto descriptor = make_descriptor(gen_fk_Double, 2, 2, data);
+        gen_handle *bound = gen_bind_array(&descriptor);
+        EXPECT_THROW(scale(bound, 2), std::runtime_error);
+        descriptor.dims[0] = 3;
+        gen_rebind_array(bound, &descriptor);
+        EXPECT_NO_THROW(scale(bound, 2));
+        gen_release(bound);
+    }
+
+    const char expected_c_interface[] = R"?(// This file is generated!
+#pragma once
+
+#include <cpp_bindgen/array_descriptor.h>
+#include <cpp_bindgen/c_attributes.h>
+#include <cpp_bindgen/handle.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void scale(gen_handle*, double) GEN_NONNULL(1);
+double sum(gen_handle*) GEN_NONNULL(1);
+
+#ifdef __cplusplus
+}
+#endif
+)?";
+
+    TEST(bound_array, c_interface) {
+        std::ostringstream strm;
+        cpp_bindgen::generate_c_interface(strm);
+        EXPECT_EQ(strm.str(), expected_c_interface);
+    }
+} // namespace
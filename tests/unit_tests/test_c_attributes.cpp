@@ -0,0 +1,87 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#define CPP_BINDGEN_RESTRICT
+#include <cpp_bindgen/export.hpp>
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+namespace cpp_bindgen {
+    namespace {
+        void axpy_impl(int n, double a, double const *x, double *y) {
+            for (int i = 0; i < n; ++i)
+                y[i] += a * x[i];
+        }
+        GEN_EXPORT_BINDING_4(attributes_axpy, axpy_impl);
+
+        double norm_impl(double const &x, double const &y) noexcept { return x * x + y * y; }
+        GEN_EXPORT_BINDING_2(attributes_norm, norm_impl);
+
+        void fill_impl(int (&dst)[2][3], int value) {
+            for (auto &row : dst)
+                for (auto &elem : row)
+                    elem = value;
+        }
+        GEN_EXPORT_BINDING_WRAPPED_2(attributes_fill, fill_impl);
+
+        int add_impl(int a, int b) noexcept { return a + b; }
+        GEN_EXPORT_BINDING_2(attributes_add, add_impl);
+
+        TEST(c_attributes, c_array_descriptor) {
+            int extents[] = {2, 3};
+            int data[2][3];
+            auto descriptor = gen_c_array_descriptor(gen_fk_Int, 2, extents, data);
+            EXPECT_EQ(descriptor.rank, 2);
+            EXPECT_EQ(descriptor.dims[0], 3);
+            EXPECT_EQ(descriptor.dims[1], 2);
+            EXPECT_EQ(descriptor.dims[2], 0);
+            attributes_fill(&descriptor, 7);
+            EXPECT_EQ(data[1][2], 7);
+        }
+
+        TEST(c_attributes, calls) {
+            double x[] = {1, 2}, y[] = {1, 1};
+            attributes_axpy(2, 2, x, y);
+            EXPECT_EQ(y[1], 5);
+            double a = 3, b = 4;
+            EXPECT_EQ(attributes_norm(&a, &b), 25);
+            EXPECT_EQ(attributes_add(1, 2), 3);
+        }
+
+        const char expected_c_interface[] = R"?(// This file is generated!
+#pragma once
+
+#include <cpp_bindgen/array_descriptor.h>
+#include <cpp_bindgen/c_attributes.h>
+#include <cpp_bindgen/handle.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int attributes_add(int, int) GEN_NOTHROW;
+void attributes_axpy(int, double, double const* GEN_RESTRICT, double* GEN_RESTRICT);
+void attributes_fill(gen_fortran_array_descriptor*, int) GEN_NONNULL(1);
+double attributes_norm(double const* GEN_RESTRICT, double const* GEN_RESTRICT) GEN_NONNULL(1, 2) GEN_NOTHROW;
+
+#ifdef __cplusplus
+}
+#endif
+)?";
+
+        TEST(c_attributes, c_interface) {
+            std::ostringstream strm;
+            generate_c_interface(strm);
+            EXPECT_EQ(strm.str(), expected_c_interface);
+        }
+    } // namespace
+} // namespace cpp_bindgen
@@ -0,0 +1,169 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cpp_bindgen/dispatch.h>
+#include <cpp_bindgen/export.hpp>
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+namespace cpp_bindgen {
+    namespace {
+        int twice_impl(int x) { return 2 * x; }
+        GEN_EXPORT_BINDING_1(dispatch_twice, twice_impl);
+
+        void fill_impl(double (&dst)[2], double value) { dst[0] = dst[1] = value; }
+        GEN_EXPORT_BINDING_WRAPPED_2(dispatch_fill, fill_impl);
+
+        const char expected_c_dispatch[] = R"?(// This file is generated!
+#pragma once
+
+#include <cpp_bindgen/array_descriptor.h>
+#include <cpp_bindgen/dispatch.h>
+#include <cpp_bindgen/handle.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct my_lib_dispatch {
+    void *library;
+    void (*dispatch_fill)(gen_fortran_array_descriptor*, double);
+    int (*dispatch_twice)(int);
+};
+
+// The table has to be zero-initialized before it is loaded for the first time. Returns 0 if the library or
+// one of its functions can not be loaded (see gen_dispatch_error()), the table is left unchanged then.
+// Otherwise the library loaded into the table before is unloaded.
+static inline int my_lib_load(struct my_lib_dispatch *table, char const *path) {
+    struct my_lib_dispatch loaded;
+    int ok;
+    loaded.library = gen_dispatch_open(path);
+    ok = loaded.library != 0;
+    ok = ok && (loaded.dispatch_fill = (void (*)(gen_fortran_array_descriptor*, double))gen_dispatch_symbol(loaded.library, "dispatch_fill"));
+    ok = ok && (loaded.dispatch_twice = (int (*)(int))gen_dispatch_symbol(loaded.library, "dispatch_twice"));
+    if (!ok) {
+        gen_dispatch_close(loaded.library);
+        return 0;
+    }
+    gen_dispatch_close(table->library);
+    *table = loaded;
+    return 1;
+}
+
+static inline void my_lib_unload(struct my_lib_dispatch *table) {
+    gen_dispatch_close(table->library);
+    table->library = 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+)?";
+
+        TEST(dispatch, c_dispatch) {
+            std::ostringstream strm;
+            generate_c_dispatch(strm, "my_lib");
+            EXPECT_EQ(strm.str(), expected_c_dispatch);
+        }
+
+        const char expected_fortran_dispatch[] = R"?(! This file is generated!
+module my_module_dispatch
+use iso_c_binding
+implicit none
+  abstract interface
+
+    subroutine dispatch_fill_impl_t(arg0, arg1) bind(c)
+      use iso_c_binding
+      use gen_array_descriptor
+      type(gen_fortran_array_descriptor) :: arg0
+      real(c_double), value :: arg1
+    end subroutine
+    integer(c_int) function dispatch_twice_t(arg0) bind(c)
+      use iso_c_binding
+      integer(c_int), value :: arg0
+    end function
+
+  end interface
+  procedure(dispatch_fill_impl_t), pointer :: dispatch_fill_impl => null()
+  procedure(dispatch_twice_t), pointer :: dispatch_twice => null()
+  type(c_ptr), private :: my_module_library = c_null_ptr
+contains
+    logical function my_module_load(path)
+      use gen_dispatch
+      character(*), intent(in) :: path
+      type(c_ptr) :: my_module_new_library
+      type(c_funptr), dimension(2) :: my_module_symbols
+      integer :: my_module_i
+
+      my_module_load = .false.
+      my_module_new_library = gen_dispatch_open(path)
+      if (.not. c_associated(my_module_new_library)) return
+      my_module_symbols(1) = gen_dispatch_symbol(my_module_new_library, "dispatch_fill")
+      my_module_symbols(2) = gen_dispatch_symbol(my_module_new_library, "dispatch_twice")
+      do my_module_i = 1, 2
+        if (.not. c_associated(my_module_symbols(my_module_i))) then
+          call gen_dispatch_close(my_module_new_library)
+          return
+        end if
+      end do
+      call my_module_unload()
+      my_module_library = my_module_new_library
+      call c_f_procpointer(my_module_symbols(1), dispatch_fill_impl)
+      call c_f_procpointer(my_module_symbols(2), dispatch_twice)
+      my_module_load = .true.
+    end function
+    subroutine my_module_unload()
+      use gen_dispatch
+
+      nullify(dispatch_fill_impl)
+      nullify(dispatch_twice)
+      call gen_dispatch_close(my_module_library)
+      my_module_library = c_null_ptr
+    end subroutine
+    subroutine dispatch_fill(arg0, arg1)
+      use iso_c_binding
+      use gen_array_descriptor
+      real(c_double), dimension(:), contiguous, intent(inout), target :: arg0
+      real(c_double), value :: arg1
+      type(gen_fortran_array_descriptor) :: descriptor0
+
+      if (any(shape(arg0) /= (/2/))) error stop "dispatch_fill: arg0 has the wrong shape"
+
+      descriptor0%rank = 1
+      descriptor0%type = 6
+      descriptor0%dims = reshape(shape(arg0), &
+        shape(descriptor0%dims), (/0/))
+      descriptor0%data = c_loc(arg0(lbound(arg0, 1)))
+
+      call dispatch_fill_impl(descriptor0, arg1)
+    end subroutine
+end
+)?";
+
+        TEST(dispatch, fortran_dispatch) {
+            std::ostringstream strm;
+            generate_fortran_dispatch(strm, "my_module");
+            EXPECT_EQ(strm.str(), expected_fortran_dispatch);
+        }
+
+        TEST(dispatch, file_name) {
+            EXPECT_EQ(dispatch_file_name("dir/lib.h"), "dir/lib_dispatch.h");
+            EXPECT_EQ(dispatch_file_name("dir.d/lib"), "dir.d/lib_dispatch");
+        }
+
+        TEST(dispatch, missing_library) {
+            EXPECT_EQ(gen_dispatch_open("libgen_dispatch_missing.so"), nullptr);
+            EXPECT_NE(gen_dispatch_error(), nullptr);
+            gen_dispatch_close(nullptr);
+        }
+    } // namespace
+} // namespace cpp_bindgen
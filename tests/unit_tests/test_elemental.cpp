@@ -0,0 +1,210 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cpp_bindgen/export.hpp>
+
+#include <sstream>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+    double saturation_impl(double t, float p) { return 2 * t + p; }
+    GEN_EXPORT_ELEMENTAL_BINDING(2, saturation, saturation_impl);
+
+    gen_fortran_array_descriptor make_descriptor(gen_fortran_array_kind type, int n, int m, void *data) {
+        gen_fortran_array_descriptor descriptor;
+        descriptor.type = type;
+        descriptor.rank = 2;
+        descriptor.dims[0] = n;
+        descriptor.dims[1] = m;
+        descriptor.data = data;
+        descriptor.is_acc_present = false;
+        return descriptor;
+    }
+
+    TEST(elemental, scalar) { EXPECT_EQ(7, saturation_scalar(2, 3)); }
+
+    TEST(elemental, array) {
+        double t[3][2] = {{1, 2}, {3, 4}, {5, 6}};
+        float p[3][2] = {{6, 5}, {4, 3}, {2, 1}};
+        double res[3][2];
+        auto t_descriptor = make_descriptor(gen_fk_Double, 2, 3, t);
+        auto p_descriptor = make_descriptor(gen_fk_Float, 2, 3, p);
+        auto res_descriptor = make_descriptor(gen_fk_Double, 2, 3, res);
+
+        saturation_array(&res_descriptor, &t_descriptor, &p_descriptor);
+
+        for (int i = 0; i < 3; ++i)
+            for (int j = 0; j < 2; ++j)
+                EXPECT_EQ(saturation_impl(t[i][j], p[i][j]), res[i][j]);
+    }
+
+    TEST(elemental, array_mismatch) {
+        double t[6] = {};
+        double p[6] = {};
+        double res[6];
+        auto t_descriptor = make_descriptor(gen_fk_Double, 2, 3, t);
+        auto p_descriptor = make_descriptor(gen_fk_Double, 2, 3, p);
+        auto res_descriptor = make_descriptor(gen_fk_Double, 3, 2, res);
+
+        EXPECT_THROW(saturation_array(&res_descriptor, &t_descriptor, &p_descriptor), std::runtime_error);
+        res_descriptor = make_descriptor(gen_fk_Double, 2, 3, res);
+        EXPECT_THROW(saturation_array(&res_descriptor, &t_descriptor, &p_descriptor), std::runtime_error);
+    }
+
+    const char expected_c_interface[] = R"?(// This file is generated!
+#pragma once
+
+#include <cpp_bindgen/array_descriptor.h>
+#include <cpp_bindgen/c_attributes.h>
+#include <cpp_bindgen/handle.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void saturation_array(gen_fortran_array_descriptor*, gen_fortran_array_descriptor*, gen_fortran_array_descriptor*) GEN_NONNULL(1, 2, 3);
+double saturation_scalar(double, float);
+
+#ifdef __cplusplus
+}
+#endif
+)?";
+
+    TEST(elemental, c_interface) {
+        std::ostringstream strm;
+        cpp_bindgen::generate_c_interface(strm);
+        EXPECT_EQ(strm.str(), expected_c_interface);
+    }
+
+    const char expected_fortran_interface[] = R"?(! This file is generated!
+module my_module
+implicit none
+  interface
+
+    subroutine saturation_array_impl(arg0, arg1, arg2) bind(c, name="saturation_array")
+      use iso_c_binding
+      use gen_array_descriptor
+      type(gen_fortran_array_descriptor) :: arg0
+      type(gen_fortran_array_descriptor) :: arg1
+      type(gen_fortran_array_descriptor) :: arg2
+    end subroutine
+    real(c_double) function saturation_scalar(arg0, arg1) bind(c)
+      use iso_c_binding
+      real(c_double), value :: arg0
+      real(c_float), value :: arg1
+    end function
+
+  end interface
+  interface saturation
+    procedure saturation_scalar, saturation_array1, saturation_array2, saturation_array3
+  end interface
+contains
+    function saturation_array1(arg0, arg1) result(res)
+      use iso_c_binding
+      use gen_array_descriptor
+      real(c_double), dimension(:), contiguous, intent(in), target :: arg0
+      real(c_float), dimension(:), contiguous, intent(in), target :: arg1
+      real(c_double), dimension(size(arg0, 1)), target :: res
+      type(gen_fortran_array_descriptor) :: descriptor_res
+      type(gen_fortran_array_descriptor) :: descriptor0
+      type(gen_fortran_array_descriptor) :: descriptor1
+
+      descriptor_res%rank = 1
+      descriptor_res%type = 6
+      descriptor_res%dims = reshape(shape(res), &
+        shape(descriptor_res%dims), (/0/))
+      descriptor_res%data = c_loc(res(lbound(res, 1)))
+
+      descriptor0%rank = 1
+      descriptor0%type = 6
+      descriptor0%dims = reshape(shape(arg0), &
+        shape(descriptor0%dims), (/0/))
+      descriptor0%data = c_loc(arg0(lbound(arg0, 1)))
+
+      descriptor1%rank = 1
+      descriptor1%type = 5
+      descriptor1%dims = reshape(shape(arg1), &
+        shape(descriptor1%dims), (/0/))
+      descriptor1%data = c_loc(arg1(lbound(arg1, 1)))
+
+      call saturation_array_impl(descriptor_res, descriptor0, descriptor1)
+    end function
+    function saturation_array2(arg0, arg1) result(res)
+      use iso_c_binding
+      use gen_array_descriptor
+      real(c_double), dimension(:,:), contiguous, intent(in), target :: arg0
+      real(c_float), dimension(:,:), contiguous, intent(in), target :: arg1
+      real(c_double), dimension(size(arg0, 1),size(arg0, 2)), target :: res
+      type(gen_fortran_array_descriptor) :: descriptor_res
+      type(gen_fortran_array_descriptor) :: descriptor0
+      type(gen_fortran_array_descriptor) :: descriptor1
+
+      descriptor_res%rank = 2
+      descriptor_res%type = 6
+      descriptor_res%dims = reshape(shape(res), &
+        shape(descriptor_res%dims), (/0/))
+      descriptor_res%data = c_loc(res(lbound(res, 1),lbound(res, 2)))
+
+      descriptor0%rank = 2
+      descriptor0%type = 6
+      descriptor0%dims = reshape(shape(arg0), &
+        shape(descriptor0%dims), (/0/))
+      descriptor0%data = c_loc(arg0(lbound(arg0, 1),lbound(arg0, 2)))
+
+      descriptor1%rank = 2
+      descriptor1%type = 5
+      descriptor1%dims = reshape(shape(arg1), &
+        shape(descriptor1%dims), (/0/))
+      descriptor1%data = c_loc(arg1(lbound(arg1, 1),lbound(arg1, 2)))
+
+      call saturation_array_impl(descriptor_res, descriptor0, descriptor1)
+    end function
+    function saturation_array3(arg0, arg1) result(res)
+      use iso_c_binding
+      use gen_array_descriptor
+      real(c_double), dimension(:,:,:), contiguous, intent(in), target :: arg0
+      real(c_float), dimension(:,:,:), contiguous, intent(in), target :: arg1
+      real(c_double), dimension(size(arg0, 1),size(arg0, 2),size(arg0, 3)), target :: res
+      type(gen_fortran_array_descriptor) :: descriptor_res
+      type(gen_fortran_array_descriptor) :: descriptor0
+      type(gen_fortran_array_descriptor) :: descriptor1
+
+      descriptor_res%rank = 3
+      descriptor_res%type = 6
+      descriptor_res%dims = reshape(shape(res), &
+        shape(descriptor_res%dims), (/0/))
+      descriptor_res%data = c_loc(res(lbound(res, 1),lbound(res, 2),lbound(res, 3)))
+
+      descriptor0%rank = 3
+      descriptor0%type = 6
+      descriptor0%dims = reshape(shape(arg0), &
+        shape(descriptor0%dims), (/0/))
+      descriptor0%data = c_loc(arg0(lbound(arg0, 1),lbound(arg0, 2),lbound(arg0, 3)))
+
+      descriptor1%rank = 3
+      descriptor1%type = 5
+      descriptor1%dims = reshape(shape(arg1), &
+        shape(descriptor1%dims), (/0/))
+      descriptor1%data = c_loc(arg1(lbound(arg1, 1),lbound(arg1, 2),lbound(arg1, 3)))
+
+      call saturation_array_impl(descriptor_res, descriptor0, descriptor1)
+    end function
+end
+)?";
+
+    TEST(elemental, fortran_interface) {
+        std::ostringstream strm;
+        cpp_bindgen::generate_fortran_interface(strm, "my_module");
+        EXPECT_EQ(strm.str(), expected_fortran_interface);
+    }
+} // namespace
@@ -89,23 +89,24 @@ namespace {
 #pragma once
 
 #include <cpp_bindgen/array_descriptor.h>
+#include <cpp_bindgen/c_attributes.h>
 #include <cpp_bindgen/handle.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-void my_assign0(gen_fortran_array_descriptor*, int);
-void my_assign1(gen_fortran_array_descriptor*, double);
+void my_assign0(gen_fortran_array_descriptor*, int) GEN_NONNULL(1);
+void my_assign1(gen_fortran_array_descriptor*, double) GEN_NONNULL(1);
 gen_handle* my_create();
-bool my_empty(gen_handle*);
-void my_pop(gen_handle*);
-void my_push0(gen_handle*, float);
-void my_push1(gen_handle*, int);
-void my_push2(gen_handle*, double);
-double my_top(gen_handle*);
-void test_c_bindings_and_wrapper_compatible_type_a(gen_fortran_array_descriptor*, gen_fortran_array_descriptor*);
-void test_c_bindings_and_wrapper_compatible_type_b(gen_fortran_array_descriptor*, gen_fortran_array_descriptor*);
+bool my_empty(gen_handle*) GEN_NONNULL(1);
+void my_pop(gen_handle*) GEN_NONNULL(1);
+void my_push0(gen_handle*, float) GEN_NONNULL(1);
+void my_push1(gen_handle*, int) GEN_NONNULL(1);
+void my_push2(gen_handle*, double) GEN_NONNULL(1);
+double my_top(gen_handle*) GEN_NONNULL(1);
+void test_c_bindings_and_wrapper_compatible_type_a(gen_fortran_array_descriptor*, gen_fortran_array_descriptor*) GEN_NONNULL(1, 2);
+void test_c_bindings_and_wrapper_compatible_type_b(gen_fortran_array_descriptor*, gen_fortran_array_descriptor*) GEN_NONNULL(1, 2);
 
 #ifdef __cplusplus
 }
@@ -190,10 +191,12 @@ contains
     subroutine my_assign0(arg0, arg1)
       use iso_c_binding
       use gen_array_descriptor
-      integer(c_int), dimension(:,:), target :: arg0
-      integer(c_int), value, target :: arg1
+      integer(c_int), dimension(:,:), contiguous, intent(inout), target :: arg0
+      integer(c_int), value :: arg1
       type(gen_fortran_array_descriptor) :: descriptor0
 
+      if (any(shape(arg0) /= (/2, 2/))) error stop "my_assign0: arg0 has the wrong shape"
+
       descriptor0%rank = 2
       descriptor0%type = 1
       descriptor0%dims = reshape(shape(arg0), &
@@ -205,10 +208,12 @@ contains
     subroutine my_assign1(arg0, arg1)
       use iso_c_binding
       use gen_array_descriptor
-      real(c_double), dimension(:,:), target :: arg0
-      real(c_double), value, target :: arg1
+      real(c_double), dimension(:,:), contiguous, intent(inout), target :: arg0
+      real(c_double), value :: arg1
       type(gen_fortran_array_descriptor) :: descriptor0
 
+      if (any(shape(arg0) /= (/2, 2/))) error stop "my_assign1: arg0 has the wrong shape"
+
       descriptor0%rank = 2
       descriptor0%type = 6
       descriptor0%dims = reshape(shape(arg0), &
@@ -220,8 +225,8 @@ contains
     subroutine test_c_bindings_and_wrapper_compatible_type_b(arg0, arg1)
       use iso_c_binding
       use gen_array_descriptor
-      type(gen_fortran_array_descriptor), target :: arg0
-      integer(c_int), dimension(:,:), target :: arg1
+      type(gen_fortran_array_descriptor) :: arg0
+      integer(c_int), dimension(:,:), contiguous, intent(inout), target :: arg1
       type(gen_fortran_array_descriptor) :: descriptor1
 
       descriptor1%rank = 2
@@ -120,7 +120,7 @@ namespace cpp_bindgen {
             static_assert(!is_fortran_array_wrappable<gen_fortran_array_descriptor &>::value, "");
             TEST(FortranArrayView, FortranArrayDescriptorIsBindable) {
                 float data[1][2][3][4];
-                gen_fortran_array_descriptor descriptor{gen_fk_Float, 4, {4, 3, 2, 1}, &data[0]};
+                gen_fortran_array_descriptor descriptor{gen_fk_Float, 4, {4, 3, 2, 1}, &data[0], false};
 
                 auto new_descriptor = make_fortran_array_view<gen_fortran_array_descriptor>(&descriptor);
                 EXPECT_EQ(new_descriptor, descriptor);
@@ -134,7 +134,7 @@ namespace cpp_bindgen {
             static_assert(!is_fortran_array_wrappable<int (*)[2][3]>::value, "");
             TEST(FortranArrayView, CArrayReferenceIsBindable) {
                 float data[1][2][3][4];
-                gen_fortran_array_descriptor descriptor{gen_fk_Float, 4, {4, 3, 2, 1}, &data[0]};
+                gen_fortran_array_descriptor descriptor{gen_fk_Float, 4, {4, 3, 2, 1}, &data[0], false};
 
                 auto &view = make_fortran_array_view<float(&)[1][2][3][4]>(&descriptor);
                 static_assert(std::is_same<decltype(view), float(&)[1][2][3][4]>::value, "");
@@ -145,6 +145,20 @@ namespace cpp_bindgen {
                 EXPECT_THROW(make_fortran_array_view<float(&)[1][2][3]>(&descriptor), std::runtime_error);
                 EXPECT_THROW(make_fortran_array_view<float(&)[1][2][3][4][5]>(&descriptor), std::runtime_error);
             }
+            TEST(FortranArrayView, TrustedCArrayReference) {
+                float data[1][2][3][4];
+                gen_fortran_array_descriptor descriptor{gen_fk_Float, 4, {4, 3, 2, 1}, &data[0], false};
+
+                auto &view = make_trusted_fortran_array_view<float(&)[1][2][3][4]>(&descriptor);
+                static_assert(std::is_same<decltype(view), float(&)[1][2][3][4]>::value, "");
+                EXPECT_EQ(view, descriptor.data);
+
+                EXPECT_TRUE(_impl::fortran_array_matches<float[1][2][3][4]>(descriptor));
+                EXPECT_FALSE(_impl::fortran_array_matches<float[1][2][3][3]>(descriptor));
+                EXPECT_FALSE(_impl::fortran_array_matches<float[1][2][3]>(descriptor));
+                EXPECT_FALSE(_impl::fortran_array_matches<int[1][2][3][4]>(descriptor));
+                EXPECT_DEBUG_DEATH(make_trusted_fortran_array_view<float(&)[2][2][3][4]>(&descriptor), "");
+            }
             TEST(FortranArrayView, CArrayReferenceIsWrappable) {
                 float data[1][2][3][4];
                 auto meta = get_fortran_view_meta(decltype (&data)(nullptr));
@@ -157,6 +171,17 @@ namespace cpp_bindgen {
                 EXPECT_EQ(meta.dims[3], 4);
             }
 
+            using c_array_meta = fortran_view_meta<float (&)[1][2][3][4]>;
+            static_assert(c_array_meta::kind == gen_fk_Float, "");
+            static_assert(c_array_meta::rank == 4, "");
+            static_assert(!c_array_meta::is_acc_present, "");
+            static_assert(c_array_meta::has_static_extents, "");
+            static_assert(std::is_same<c_array_meta::extents, integer_sequence<int, 4, 3, 2, 1>>::value, "");
+            static_assert(c_array_meta::extent(0) == 4 && c_array_meta::extent(3) == 1, "");
+            static_assert(has_static_fortran_view_meta<int const (&)[2]>::value, "");
+            static_assert(!has_static_fortran_view_meta<int[2]>::value, "");
+            static_assert(!has_static_fortran_view_meta<gen_fortran_array_descriptor>::value, "");
+
             struct NotBindableNotWrappableClass {};
             static_assert(!is_fortran_array_bindable<NotBindableNotWrappableClass>::value, "");
             static_assert(!is_fortran_array_bindable<NotBindableNotWrappableClass &>::value, "");
@@ -199,7 +224,7 @@ namespace cpp_bindgen {
             TEST(FortranArrayView, BindableStaticHypercubeWithConstructorIsBindable) {
                 double data[2][2][2][2] = {
                     {{{1., 2.}, {3., 4.}}, {{5., 6.}, {7., 8.}}}, {{{9., 10.}, {11., 12.}}, {{13., 14.}, {15., 16.}}}};
-                gen_fortran_array_descriptor descriptor{gen_fk_Double, 4, {2, 2, 2, 2}, &data[0]};
+                gen_fortran_array_descriptor descriptor{gen_fk_Double, 4, {2, 2, 2, 2}, &data[0], false};
 
                 BindableStaticHypercubeWithConstructor<4> view =
                     make_fortran_array_view<BindableStaticHypercubeWithConstructor<4>>(&descriptor);
@@ -247,7 +272,7 @@ namespace cpp_bindgen {
             TEST(FortranArrayView, WrappableStaticHypercubeWithMetaTypesIsBindable) {
                 double data[2][2][2][2] = {
                     {{{1., 2.}, {3., 4.}}, {{5., 6.}, {7., 8.}}}, {{{9., 10.}, {11., 12.}}, {{13., 14.}, {15., 16.}}}};
-                gen_fortran_array_descriptor descriptor{gen_fk_Double, 4, {2, 2, 2, 2}, &data[0]};
+                gen_fortran_array_descriptor descriptor{gen_fk_Double, 4, {2, 2, 2, 2}, &data[0], false};
 
                 WrappableStaticHypercubeWithMetaTypes<4> view =
                     make_fortran_array_view<WrappableStaticHypercubeWithMetaTypes<4>>(&descriptor);
@@ -261,6 +286,21 @@ namespace cpp_bindgen {
                 EXPECT_EQ(meta.rank, 3);
             }
 
+            using meta_types_meta = fortran_view_meta<WrappableStaticHypercubeWithMetaTypes<3>>;
+            static_assert(meta_types_meta::kind == gen_fk_Double, "");
+            static_assert(meta_types_meta::rank == 3, "");
+            static_assert(!meta_types_meta::has_static_extents, "");
+            static_assert(meta_types_meta::extent(0) == 0, "");
+
+            struct WrappableStaticCubeWithStaticExtents : WrappableStaticHypercubeWithMetaTypes<3> {
+                using WrappableStaticHypercubeWithMetaTypes<3>::WrappableStaticHypercubeWithMetaTypes;
+                using gen_view_extents = integer_sequence<int, 2, 2, 2>;
+            };
+            using static_extents_meta = fortran_view_meta<WrappableStaticCubeWithStaticExtents>;
+            static_assert(static_extents_meta::has_static_extents, "");
+            static_assert(std::is_same<static_extents_meta::extents, integer_sequence<int, 2, 2, 2>>::value, "");
+            static_assert(static_extents_meta::extent(2) == 2, "");
+
             static_assert(!is_fortran_array_bindable<adltest::DynamicHypercube &>::value, "");
             static_assert(is_fortran_array_bindable<adltest::DynamicHypercube>::value, "");
             static_assert(!is_fortran_array_wrappable<adltest::DynamicHypercube &>::value, "");
@@ -268,7 +308,7 @@ namespace cpp_bindgen {
             TEST(FortranArrayView, BindableDynamicHypercubeWithFactoryFunctionIsBindable) {
                 double data[2][2][2][2] = {
                     {{{1., 2.}, {3., 4.}}, {{5., 6.}, {7., 8.}}}, {{{9., 10.}, {11., 12.}}, {{13., 14.}, {15., 16.}}}};
-                gen_fortran_array_descriptor descriptor{gen_fk_Double, 4, {2, 2, 2, 2}, &data[0]};
+                gen_fortran_array_descriptor descriptor{gen_fk_Double, 4, {2, 2, 2, 2}, &data[0], false};
 
                 adltest::DynamicHypercube view = make_fortran_array_view<adltest::DynamicHypercube>(&descriptor);
                 EXPECT_EQ(view(0, 1, 0, 1), 6.);
@@ -282,12 +322,13 @@ namespace cpp_bindgen {
             TEST(FortranArrayView, WrappableStaticHypercubeWithMetaFunctionIsBindable) {
                 double data[2][2][2][2] = {
                     {{{1., 2.}, {3., 4.}}, {{5., 6.}, {7., 8.}}}, {{{9., 10.}, {11., 12.}}, {{13., 14.}, {15., 16.}}}};
-                gen_fortran_array_descriptor descriptor{gen_fk_Double, 4, {2, 2, 2, 2}, &data[0]};
+                gen_fortran_array_descriptor descriptor{gen_fk_Double, 4, {2, 2, 2, 2}, &data[0], false};
 
                 adltest::StaticHypercube<4> view = make_fortran_array_view<adltest::StaticHypercube<4>>(&descriptor);
                 EXPECT_EQ(view(0, 1, 0, 1), 6.);
                 EXPECT_EQ(view(1, 0, 1, 0), 11.);
             }
+            static_assert(!has_static_fortran_view_meta<adltest::StaticHypercube<3>>::value, "");
             TEST(FortranArrayView, WrappableStaticHypercubeWithMetaFunctionIsWrappable) {
                 gen_fortran_array_descriptor meta = get_fortran_view_meta((adltest::StaticHypercube<3> *){nullptr});
                 EXPECT_EQ(meta.type, gen_fk_Double);
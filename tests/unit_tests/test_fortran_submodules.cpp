@@ -0,0 +1,137 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cpp_bindgen/export.hpp>
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+namespace cpp_bindgen {
+    namespace {
+        int twice_impl(int x) { return 2 * x; }
+        GEN_EXPORT_BINDING_1(submodules_twice, twice_impl);
+
+        void fill_impl(double (&dst)[2], double value) { dst[0] = dst[1] = value; }
+        GEN_EXPORT_BINDING_WRAPPED_2(submodules_fill, fill_impl);
+
+        float norm_impl(float const (&src)[3]) { return src[0] * src[0] + src[1] * src[1] + src[2] * src[2]; }
+        GEN_EXPORT_BINDING_WRAPPED_1(submodules_norm, norm_impl);
+
+        const char expected_fortran_interface[] = R"?(! This file is generated!
+module my_module
+implicit none
+  interface
+
+    subroutine submodules_fill_impl(arg0, arg1) bind(c, name="submodules_fill")
+      use iso_c_binding
+      use gen_array_descriptor
+      type(gen_fortran_array_descriptor) :: arg0
+      real(c_double), value :: arg1
+    end subroutine
+    real(c_float) function submodules_norm_impl(arg0) bind(c, name="submodules_norm")
+      use iso_c_binding
+      use gen_array_descriptor
+      type(gen_fortran_array_descriptor) :: arg0
+    end function
+    integer(c_int) function submodules_twice(arg0) bind(c)
+      use iso_c_binding
+      integer(c_int), value :: arg0
+    end function
+
+  end interface
+  interface
+
+    module subroutine submodules_fill(arg0, arg1)
+      use iso_c_binding
+      use gen_array_descriptor
+      real(c_double), dimension(:), contiguous, intent(inout), target :: arg0
+      real(c_double), value :: arg1
+    end subroutine
+    module real(c_float) function submodules_norm(arg0)
+      use iso_c_binding
+      use gen_array_descriptor
+      real(c_float), dimension(:), contiguous, intent(in), target :: arg0
+    end function
+
+  end interface
+end
+)?";
+
+        TEST(fortran_submodules, fortran_interface) {
+            std::ostringstream strm;
+            generate_fortran_interface(strm, "my_module", 2);
+            EXPECT_EQ(strm.str(), expected_fortran_interface);
+        }
+
+        const char expected_fortran_submodule[] = R"?(! This file is generated!
+submodule (my_module) my_module_1
+implicit none
+contains
+    module procedure submodules_fill
+      use iso_c_binding
+      use gen_array_descriptor
+      type(gen_fortran_array_descriptor) :: descriptor0
+
+      if (any(shape(arg0) /= (/2/))) error stop "submodules_fill: arg0 has the wrong shape"
+
+      descriptor0%rank = 1
+      descriptor0%type = 6
+      descriptor0%dims = reshape(shape(arg0), &
+        shape(descriptor0%dims), (/0/))
+      descriptor0%data = c_loc(arg0(lbound(arg0, 1)))
+
+      call submodules_fill_impl(descriptor0, arg1)
+    end procedure
+    module procedure submodules_norm
+      use iso_c_binding
+      use gen_array_descriptor
+      type(gen_fortran_array_descriptor) :: descriptor0
+
+      if (any(shape(arg0) /= (/3/))) error stop "submodules_norm: arg0 has the wrong shape"
+
+      descriptor0%rank = 1
+      descriptor0%type = 5
+      descriptor0%dims = reshape(shape(arg0), &
+        shape(descriptor0%dims), (/0/))
+      descriptor0%data = c_loc(arg0(lbound(arg0, 1)))
+
+      submodules_norm = submodules_norm_impl(descriptor0)
+    end procedure
+end
+)?";
+
+        TEST(fortran_submodules, fortran_submodule) {
+            std::ostringstream strm;
+            generate_fortran_submodule(strm, "my_module", 1, 1);
+            EXPECT_EQ(strm.str(), expected_fortran_submodule);
+        }
+
+        TEST(fortran_submodules, distribution) {
+            std::string all;
+            for (int i = 1; i <= 3; ++i) {
+                std::ostringstream strm;
+                generate_fortran_submodule(strm, "my_module", i, 3);
+                all += strm.str();
+            }
+            for (char const *name : {"submodules_fill\n", "submodules_norm\n"}) {
+                auto pos = all.find(std::string("module procedure ") + name);
+                ASSERT_NE(pos, std::string::npos);
+                EXPECT_EQ(all.find(std::string("module procedure ") + name, pos + 1), std::string::npos);
+            }
+            EXPECT_EQ(all.find("submodules_twice"), std::string::npos);
+        }
+
+        TEST(fortran_submodules, file_name) {
+            EXPECT_EQ(fortran_submodule_file_name("dir/lib.f90", 2), "dir/lib_2.f90");
+            EXPECT_EQ(fortran_submodule_file_name("dir.d/lib", 1), "dir.d/lib_1");
+        }
+    } // namespace
+} // namespace cpp_bindgen
@@ -11,6 +11,7 @@
 #include <cpp_bindgen/function_wrapper.hpp>
 
 #include <iostream>
+#include <stdexcept>
 #include <stack>
 #include <type_traits>
 
@@ -104,6 +105,17 @@ namespace cpp_bindgen {
             gen_release(obj2);
         }
 
+        int first(int (&arr)[2][3]) { return arr[0][0]; }
+
+        TEST(wrap, trusted) {
+            int arr[2][3] = {{1}};
+            gen_fortran_array_descriptor descriptor{gen_fk_Int, 2, {3, 2}, arr, false};
+            EXPECT_EQ(1, wrap(first)(&descriptor));
+            EXPECT_EQ(1, wrap_trusted(first)(&descriptor));
+            descriptor.dims[0] = 2;
+            EXPECT_THROW(wrap(first)(&descriptor), std::runtime_error);
+        }
+
         void inc(int &val) { ++val; }
 
         TEST(wrap, const_expr) {
@@ -139,6 +151,24 @@ namespace cpp_bindgen {
                 [](int(&array)[2][3], size_t i, size_t j) { return array[i][j]; });
             EXPECT_EQ(array[0][0], get(&descriptor, 0, 0));
         }
+
+        double axpy(double a, double const *x, double y) { return a * *x + y; }
+        int deref(int const &x) { return x; }
+
+        TEST(wrap_elided, identity_signature) {
+            static_assert(std::is_same<decltype(wrap_elided<double(double, double const *, double)>(axpy)),
+                              double (*)(double, double const *, double)>::value,
+                "");
+            double x = 2;
+            EXPECT_EQ(wrap_elided<double(double, double const *, double)>(axpy)(3, &x, 1), 7);
+        }
+
+        TEST(wrap_elided, converted_signature) {
+            static_assert(
+                !std::is_same<decltype(wrap_elided<int(int const &)>(deref)), int (*)(int const &)>::value, "");
+            int x = 3;
+            EXPECT_EQ(wrap_elided<int(int const &)>(deref)(&x), 3);
+        }
     } // namespace
 } // namespace cpp_bindgen
 
@@ -22,6 +22,7 @@ namespace cpp_bindgen {
         GEN_ADD_GENERATED_DECLARATION(gen_handle *(int, double const *, gen_handle *), bar);
         GEN_ADD_GENERATED_DECLARATION(void(int *const *volatile *const *), baz);
         GEN_ADD_GENERATED_DECLARATION_WRAPPED(void(int, int (&)[1][2][3]), qux);
+        GEN_ADD_GENERATED_DECLARATION_WRAPPED(void(double const (&)[4], float &), quux);
 
         GEN_ADD_GENERIC_DECLARATION(foo, bar);
         GEN_ADD_GENERIC_DECLARATION(foo, baz);
@@ -30,16 +31,18 @@ namespace cpp_bindgen {
 #pragma once
 
 #include <cpp_bindgen/array_descriptor.h>
+#include <cpp_bindgen/c_attributes.h>
 #include <cpp_bindgen/handle.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-gen_handle* bar(int, double*, gen_handle*);
-void baz(int****);
+gen_handle* bar(int, double const*, gen_handle*) GEN_NONNULL(3);
+void baz(int* const* volatile* const*);
 void foo();
-void qux(int, gen_fortran_array_descriptor*);
+void quux(gen_fortran_array_descriptor*, float*) GEN_NONNULL(1);
+void qux(int, gen_fortran_array_descriptor*) GEN_NONNULL(2);
 
 #ifdef __cplusplus
 }
@@ -60,7 +63,7 @@ implicit none
     type(c_ptr) function bar(arg0, arg1, arg2) bind(c)
       use iso_c_binding
       integer(c_int), value :: arg0
-      real(c_double), dimension(*) :: arg1
+      real(c_double), dimension(*), intent(in) :: arg1
       type(c_ptr), value :: arg2
     end function
     subroutine baz(arg0) bind(c)
@@ -70,6 +73,12 @@ implicit none
     subroutine foo() bind(c)
       use iso_c_binding
     end subroutine
+    subroutine quux_impl(arg0, arg1) bind(c, name="quux")
+      use iso_c_binding
+      use gen_array_descriptor
+      type(gen_fortran_array_descriptor) :: arg0
+      real(c_float), dimension(*), intent(inout) :: arg1
+    end subroutine
     subroutine qux_impl(arg0, arg1) bind(c, name="qux")
       use iso_c_binding
       use gen_array_descriptor
@@ -82,13 +91,32 @@ implicit none
     procedure bar, baz
   end interface
 contains
+    subroutine quux(arg0, arg1)
+      use iso_c_binding
+      use gen_array_descriptor
+      real(c_double), dimension(:), contiguous, intent(in), target :: arg0
+      real(c_float), dimension(*), intent(inout) :: arg1
+      type(gen_fortran_array_descriptor) :: descriptor0
+
+      if (any(shape(arg0) /= (/4/))) error stop "quux: arg0 has the wrong shape"
+
+      descriptor0%rank = 1
+      descriptor0%type = 6
+      descriptor0%dims = reshape(shape(arg0), &
+        shape(descriptor0%dims), (/0/))
+      descriptor0%data = c_loc(arg0(lbound(arg0, 1)))
+
+      call quux_impl(descriptor0, arg1)
+    end subroutine
     subroutine qux(arg0, arg1)
       use iso_c_binding
       use gen_array_descriptor
-      integer(c_int), value, target :: arg0
-      integer(c_int), dimension(:,:,:), target :: arg1
+      integer(c_int), value :: arg0
+      integer(c_int), dimension(:,:,:), contiguous, intent(inout), target :: arg1
       type(gen_fortran_array_descriptor) :: descriptor1
 
+      if (any(shape(arg1) /= (/3, 2, 1/))) error stop "qux: arg1 has the wrong shape"
+
       descriptor1%rank = 3
       descriptor1%type = 1
       descriptor1%dims = reshape(shape(arg1), &
@@ -105,6 +133,26 @@ end
             generate_fortran_interface(strm, "my_module");
             EXPECT_EQ(strm.str(), expected_fortran_interface);
         }
+
+        const char expected_version_script[] = R"?(/* This file is generated! */
+{
+  global:
+    bar;
+    baz;
+    foo;
+    quux;
+    qux;
+  local:
+    *;
+};
+)?";
+
+        TEST(generator, version_script) {
+            std::ostringstream strm;
+            generate_version_script(strm);
+            EXPECT_EQ(strm.str(), expected_version_script);
+        }
+
         TEST(generator, wrap_short_line) {
             const std::string prefix = "    ";
             const std::string line = "short line, short line";
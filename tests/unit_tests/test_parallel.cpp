@@ -0,0 +1,150 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cpp_bindgen/export.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+namespace cpp_bindgen {
+    namespace {
+        using field_t = descriptor_view<double, 3>;
+
+        std::mutex tiles_mutex;
+        std::set<std::pair<double *, int>> tiles;
+        std::set<std::thread::id> threads;
+
+        void fill_impl(field_t out, field_t const in, double factor) {
+            if (in.extent(2) == 0)
+                throw std::runtime_error("empty tile");
+            {
+                std::lock_guard<std::mutex> lock(tiles_mutex);
+                tiles.emplace(out.data(), out.extent(2));
+                threads.insert(std::this_thread::get_id());
+            }
+            for (std::size_t i = 0; i < out.size(); ++i)
+                out[i] = factor * in[i];
+        }
+        GEN_EXPORT_PARALLEL_BINDING(3, parallel_fill, fill_impl);
+
+        gen_fortran_array_descriptor make_descriptor(double *data, int k) {
+            return {gen_fk_Double, 3, {3, 2, k}, data, false};
+        }
+
+        TEST(parallel, outer_tile) {
+            double data[5][2][3];
+            gen_fortran_array_descriptor tile = _impl::outer_tile(make_descriptor(&data[0][0][0], 5), 1, 4);
+            EXPECT_EQ(tile.rank, 3);
+            EXPECT_EQ(tile.dims[0], 3);
+            EXPECT_EQ(tile.dims[1], 2);
+            EXPECT_EQ(tile.dims[2], 3);
+            EXPECT_EQ(tile.data, &data[1][0][0]);
+        }
+
+        TEST(parallel, tiles) {
+            double in[10][2][3];
+            double out[10][2][3];
+            for (int i = 0; i < 60; ++i)
+                (&in[0][0][0])[i] = i;
+            auto in_descriptor = make_descriptor(&in[0][0][0], 10);
+            auto out_descriptor = make_descriptor(&out[0][0][0], 10);
+
+            gen_set_parallel_num_threads(4);
+            gen_set_parallel_grain_size(3);
+            tiles.clear();
+            threads.clear();
+            parallel_fill(&out_descriptor, &in_descriptor, 2);
+
+            for (int i = 0; i < 60; ++i)
+                EXPECT_EQ((&out[0][0][0])[i], 2 * i);
+            std::set<std::pair<double *, int>> expected = {
+                {&out[0][0][0], 3}, {&out[3][0][0], 3}, {&out[6][0][0], 3}, {&out[9][0][0], 1}};
+            EXPECT_EQ(tiles, expected);
+            EXPECT_LE(threads.size(), 4);
+
+            gen_set_parallel_grain_size(1);
+            tiles.clear();
+            parallel_fill(&out_descriptor, &in_descriptor, 3);
+            EXPECT_EQ(tiles.size(), 10);
+            for (int i = 0; i < 60; ++i)
+                EXPECT_EQ((&out[0][0][0])[i], 3 * i);
+        }
+
+        TEST(parallel, errors) {
+            double in[4][2][3] = {};
+            double out[5][2][3];
+            auto in_descriptor = make_descriptor(&in[0][0][0], 4);
+            auto out_descriptor = make_descriptor(&out[0][0][0], 5);
+            EXPECT_THROW(parallel_fill(&out_descriptor, &in_descriptor, 1), std::runtime_error);
+
+            in_descriptor.type = gen_fk_Float;
+            out_descriptor = make_descriptor(&out[0][0][0], 4);
+            EXPECT_THROW(parallel_fill(&out_descriptor, &in_descriptor, 1), std::runtime_error);
+        }
+
+        TEST(parallel, concurrent_calls) {
+            // each tile waits for the tile of the other call, the calls must not be serialized
+            std::mutex mutex;
+            std::condition_variable cv;
+            int entered = 0;
+            auto fun = [&](int, int) {
+                std::unique_lock<std::mutex> lock(mutex);
+                ++entered;
+                cv.notify_all();
+                if (!cv.wait_for(lock, std::chrono::seconds(10), [&] { return entered == 2; }))
+                    throw std::runtime_error("the calls were serialized");
+            };
+            gen_set_parallel_num_threads(1);
+            bool thread_ok = false;
+            std::thread thread([&] {
+                try {
+                    parallel_for_tiles(1, fun);
+                    thread_ok = true;
+                } catch (std::runtime_error const &) {
+                }
+            });
+            EXPECT_NO_THROW(parallel_for_tiles(1, fun));
+            thread.join();
+            EXPECT_TRUE(thread_ok);
+        }
+
+        const char expected_c_interface[] = R"?(// This file is generated!
+#pragma once
+
+#include <cpp_bindgen/array_descriptor.h>
+#include <cpp_bindgen/c_attributes.h>
+#include <cpp_bindgen/handle.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void parallel_fill(gen_fortran_array_descriptor*, gen_fortran_array_descriptor*, double) GEN_NONNULL(1, 2);
+
+#ifdef __cplusplus
+}
+#endif
+)?";
+
+        TEST(parallel, c_interface) {
+            std::ostringstream strm;
+            generate_c_interface(strm);
+            EXPECT_EQ(strm.str(), expected_c_interface);
+        }
+    } // namespace
+} // namespace cpp_bindgen
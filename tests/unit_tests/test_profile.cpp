@@ -0,0 +1,118 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#define CPP_BINDGEN_PROFILE
+#include <cpp_bindgen/export.hpp>
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <cpp_bindgen/handle.h>
+#include <cpp_bindgen/profile.h>
+
+namespace {
+    using vector_t = std::vector<int>;
+
+    vector_t make_vector_impl(int size) { return vector_t(size); }
+    GEN_EXPORT_BINDING_1(make_vector, make_vector_impl);
+
+    int vector_size_impl(vector_t const &obj) { return obj.size(); }
+    GEN_EXPORT_BINDING_1(vector_size, vector_size_impl);
+
+    void fill_impl(vector_t &obj, int val) {
+        for (auto &&elem : obj)
+            elem = val;
+    }
+    GEN_EXPORT_BINDING_2(fill, fill_impl);
+
+    std::string report() {
+        std::ostringstream strm;
+        cpp_bindgen::profile_report(strm);
+        return strm.str();
+    }
+
+    std::vector<std::string> row(std::string const &name) {
+        std::istringstream strm(report());
+        std::string line;
+        while (std::getline(strm, line)) {
+            std::istringstream line_strm(line);
+            std::vector<std::string> res;
+            std::string word;
+            while (line_strm >> word)
+                res.push_back(word);
+            if (!res.empty() && res[0] == name)
+                return res;
+        }
+        return {};
+    }
+
+    TEST(profile, counters) {
+        gen_profile_reset();
+        gen_handle *obj = make_vector(3);
+        fill(obj, 1);
+        std::thread([obj] { fill(obj, 2); }).join();
+        EXPECT_EQ(3, vector_size(obj));
+        EXPECT_EQ(2, cpp_bindgen::any_cast<vector_t &>(obj->m_value)[0]);
+        gen_release(obj);
+
+        auto fill_row = row("fill");
+        ASSERT_EQ(8, fill_row.size());
+        EXPECT_EQ("2", fill_row[1]);
+        EXPECT_LE(std::stod(fill_row[3]), std::stod(fill_row[5]));
+        EXPECT_LE(std::stod(fill_row[6]), std::stod(fill_row[2]));
+        auto size_row = row("vector_size");
+        ASSERT_EQ(8, size_row.size());
+        EXPECT_EQ("1", size_row[1]);
+        EXPECT_EQ("1", row("make_vector").at(1));
+    }
+
+    TEST(profile, reset) {
+        gen_handle *obj = make_vector(3);
+        gen_release(obj);
+        EXPECT_FALSE(row("make_vector").empty());
+        gen_profile_reset();
+        EXPECT_TRUE(row("make_vector").empty());
+        EXPECT_EQ(0, report().find("binding"));
+    }
+
+    TEST(profile, counters_are_per_thread) {
+        cpp_bindgen::profile_thread_counters counters("test");
+        cpp_bindgen::profile_counters *other = nullptr;
+        std::thread([&] {
+            cpp_bindgen::profile_thread_counters thread_counters("test");
+            other = &thread_counters.get();
+        }).join();
+        EXPECT_NE(&counters.get(), other);
+    }
+
+    TEST(profile, exited_threads) {
+        // the counters of an exited thread are kept, its slot is reused
+        gen_profile_reset();
+        gen_handle *obj = make_vector(3);
+        cpp_bindgen::profile_counters *first = nullptr, *second = nullptr;
+        std::thread([&] {
+            fill(obj, 1);
+            cpp_bindgen::profile_thread_counters counters("test");
+            first = &counters.get();
+        }).join();
+        std::thread([&] {
+            fill(obj, 2);
+            cpp_bindgen::profile_thread_counters counters("test");
+            second = &counters.get();
+        }).join();
+        gen_release(obj);
+        EXPECT_EQ(first, second);
+        EXPECT_EQ("2", row("fill").at(1));
+    }
+} // namespace
@@ -0,0 +1,167 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#define CPP_BINDGEN_ENABLE_QUEUE
+#include <cpp_bindgen/export.hpp>
+
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <cpp_bindgen/handle.h>
+#include <cpp_bindgen/queue.h>
+
+namespace {
+    using log_t = std::vector<int>;
+
+    log_t make_log_impl() { return {}; }
+    GEN_EXPORT_BINDING_0(make_log, make_log_impl);
+
+    void append_impl(log_t &log, int val) { log.push_back(val); }
+    GEN_EXPORT_BINDING_2(append, append_impl);
+
+    int log_size_impl(log_t const &log) { return log.size(); }
+    GEN_EXPORT_BINDING_1(log_size, log_size_impl);
+
+    void fail_impl() { throw std::runtime_error("failure"); }
+    GEN_EXPORT_BINDING_0(fail, fail_impl);
+
+    void scale_impl(double (&arr)[2][3], double factor) {
+        for (auto &&row : arr)
+            for (auto &&elem : row)
+                elem *= factor;
+    }
+    GEN_EXPORT_BINDING_2(scale, scale_impl);
+
+    void axpy_impl(double (&y)[2][3], double const (&x)[2][3], double a) {
+        for (int i = 0; i < 2; ++i)
+            for (int j = 0; j < 3; ++j)
+                y[i][j] += a * x[i][j];
+    }
+    GEN_EXPORT_BINDING_3(axpy, axpy_impl);
+
+    void fill_impl(double (&arr)[2][3], double val) {
+        for (auto &&row : arr)
+            for (auto &&elem : row)
+                elem = val;
+    }
+    GEN_EXPORT_BINDING_2(fill, fill_impl);
+
+    gen_fortran_array_descriptor make_descriptor(double (&arr)[2][3]) {
+        gen_fortran_array_descriptor descriptor;
+        descriptor.type = gen_fk_Double;
+        descriptor.rank = 2;
+        descriptor.dims[0] = 3;
+        descriptor.dims[1] = 2;
+        descriptor.data = arr;
+        descriptor.is_acc_present = false;
+        return descriptor;
+    }
+
+    log_t &get_log(gen_handle *obj) { return cpp_bindgen::any_cast<log_t &>(obj->m_value); }
+
+    TEST(queue, deferred) {
+        gen_handle *log = make_log();
+        gen_queue_begin();
+        append(log, 1);
+        append(log, 2);
+        EXPECT_TRUE(get_log(log).empty());
+        gen_queue_flush();
+        EXPECT_EQ(log_t({1, 2}), get_log(log));
+        append(log, 3);
+        EXPECT_EQ(3u, get_log(log).size());
+        gen_release(log);
+    }
+
+    TEST(queue, non_void_call_syncs) {
+        gen_handle *log = make_log();
+        gen_queue_begin();
+        append(log, 1);
+        EXPECT_EQ(1, log_size(log));
+        append(log, 2);
+        EXPECT_EQ(1u, get_log(log).size());
+        gen_queue_flush();
+        EXPECT_EQ(log_t({1, 2}), get_log(log));
+        gen_release(log);
+    }
+
+    TEST(queue, exception) {
+        gen_handle *log = make_log();
+        gen_queue_begin();
+        append(log, 1);
+        fail();
+        append(log, 2);
+        EXPECT_THROW(gen_queue_flush(), std::runtime_error);
+        EXPECT_EQ(log_t({1}), get_log(log));
+        gen_release(log);
+    }
+
+    TEST(queue, arrays) {
+        double x[2][3] = {{1, 2, 3}, {4, 5, 6}};
+        double y[2][3] = {};
+        double z[2][3] = {{1, 1, 1}, {1, 1, 1}};
+        auto x_descriptor = make_descriptor(x);
+        auto y_descriptor = make_descriptor(y);
+        auto z_descriptor = make_descriptor(z);
+        gen_queue_begin();
+        scale(&x_descriptor, 2);
+        axpy(&y_descriptor, &x_descriptor, 1);
+        axpy(&z_descriptor, &x_descriptor, 2);
+        scale(&x_descriptor, 3);
+        EXPECT_EQ(1, x[0][0]);
+        gen_queue_flush_parallel();
+        for (int i = 0; i < 2; ++i)
+            for (int j = 0; j < 3; ++j) {
+                double expected = 2 * (3 * i + j + 1);
+                EXPECT_EQ(3 * expected, x[i][j]);
+                EXPECT_EQ(expected, y[i][j]);
+                EXPECT_EQ(1 + 2 * expected, z[i][j]);
+            }
+    }
+
+    TEST(queue, overlapping_sections) {
+        double buf[3][3] = {};
+        auto &head = reinterpret_cast<double(&)[2][3]>(buf[0]);
+        auto &tail = reinterpret_cast<double(&)[2][3]>(buf[1]);
+        auto head_descriptor = make_descriptor(head);
+        auto tail_descriptor = make_descriptor(tail);
+        gen_queue_begin();
+        fill(&head_descriptor, 1);
+        scale(&tail_descriptor, 3);
+        gen_queue_flush_parallel();
+        for (int j = 0; j < 3; ++j) {
+            EXPECT_EQ(1, buf[0][j]);
+            EXPECT_EQ(3, buf[1][j]);
+            EXPECT_EQ(0, buf[2][j]);
+        }
+    }
+
+    TEST(queue, access_range) {
+        double arr[2][3];
+        auto access = cpp_bindgen::make_queue_access(make_descriptor(arr), true);
+        EXPECT_TRUE(access.m_bounded);
+        EXPECT_EQ(reinterpret_cast<char const *>(arr), access.m_begin);
+        EXPECT_EQ(reinterpret_cast<char const *>(arr) + sizeof(arr), access.m_end);
+        EXPECT_TRUE(access.m_write);
+    }
+
+    TEST(queue, access) {
+        using cpp_bindgen::_impl::is_queue_write_param;
+        EXPECT_TRUE((is_queue_write_param<double (&)[2][3]>::value));
+        EXPECT_FALSE((is_queue_write_param<double const (&)[2][3]>::value));
+        EXPECT_TRUE(is_queue_write_param<log_t &>::value);
+        EXPECT_FALSE(is_queue_write_param<log_t const &>::value);
+        EXPECT_FALSE(is_queue_write_param<log_t>::value);
+        EXPECT_TRUE(is_queue_write_param<int *>::value);
+        EXPECT_FALSE(is_queue_write_param<int const *>::value);
+        EXPECT_FALSE(is_queue_write_param<int>::value);
+    }
+} // namespace
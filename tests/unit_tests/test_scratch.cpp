@@ -0,0 +1,196 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cpp_bindgen/export.hpp>
+
+#include <cstdint>
+#include <sstream>
+#include <type_traits>
+
+#include <gtest/gtest.h>
+
+namespace cpp_bindgen {
+    namespace {
+        static_assert(std::is_same<scratch_free_signature_t<int(scratch &, double, scratch &, float)>,
+                          int(double, float)>::value,
+            "");
+        static_assert(std::is_same<wrapped_t<void(scratch &, int &)>, void(int *)>::value, "");
+
+        TEST(scratch, allocate) {
+            scratch arena;
+            EXPECT_EQ(arena.capacity(), 0);
+            char *c = arena.allocate<char>(3);
+            double *d = arena.allocate<double>(4);
+            EXPECT_EQ(reinterpret_cast<std::uintptr_t>(d) % alignof(double), 0);
+            EXPECT_GE(reinterpret_cast<char *>(d), c + 3);
+            for (int i = 0; i < 4; ++i)
+                d[i] = i;
+            EXPECT_EQ(d[3], 3);
+        }
+
+        TEST(scratch, release) {
+            scratch arena;
+            auto empty = arena.mark();
+            int *first = arena.allocate<int>(10);
+            auto pos = arena.mark();
+            int *second = arena.allocate<int>(10);
+            arena.release(pos);
+            EXPECT_EQ(arena.allocate<int>(10), second);
+            arena.release(empty);
+            EXPECT_EQ(arena.allocate<int>(10), first);
+        }
+
+        TEST(scratch, grow) {
+            scratch arena;
+            auto empty = arena.mark();
+            arena.allocate<char>(1000);
+            std::size_t initial = arena.capacity();
+            char *big = arena.allocate<char>(initial);
+            big[initial - 1] = 1;
+            EXPECT_GT(arena.capacity(), initial);
+            std::size_t grown = arena.capacity();
+
+            // the blocks are merged once the arena is empty, later calls with the same needs do not allocate
+            arena.release(empty);
+            EXPECT_EQ(arena.capacity(), grown);
+            auto pos = arena.mark();
+            char *small = arena.allocate<char>(1000);
+            EXPECT_EQ(arena.allocate<char>(initial), small + 1000);
+            arena.release(pos);
+            EXPECT_EQ(arena.capacity(), grown);
+        }
+
+        int *last_buffer = nullptr;
+
+        int sum_impl(scratch &arena, int n) {
+            int *buffer = arena.allocate<int>(n);
+            last_buffer = buffer;
+            int res = 0;
+            for (int i = 0; i < n; ++i)
+                res += buffer[i] = i;
+            return res;
+        }
+        GEN_EXPORT_BINDING_1(scratch_sum, sum_impl);
+
+        TEST(scratch, injected) {
+            EXPECT_EQ(scratch_sum(5), 10);
+            int *first = last_buffer;
+            EXPECT_EQ(scratch_sum(100), 4950);
+            EXPECT_EQ(last_buffer, first);
+            scratch_scope scope(thread_scratch());
+            EXPECT_EQ(thread_scratch().allocate<int>(1), first);
+        }
+
+        int nested_impl(int n, scratch &arena) {
+            int *buffer = arena.allocate<int>(n);
+            for (int i = 0; i < n; ++i)
+                buffer[i] = -1;
+            int res = scratch_sum(n);
+            EXPECT_GT(last_buffer, buffer);
+            for (int i = 0; i < n; ++i)
+                res += buffer[i];
+            return res;
+        }
+        GEN_EXPORT_BINDING_1(scratch_nested, nested_impl);
+
+        TEST(scratch, nested) { EXPECT_EQ(scratch_nested(4), 2); }
+
+        void scale_impl(double (&field)[2][3], scratch &arena, double factor) {
+            double *tmp = arena.allocate<double>(6);
+            for (int i = 0; i < 6; ++i)
+                tmp[i] = factor * (&field[0][0])[i];
+            for (int i = 0; i < 6; ++i)
+                (&field[0][0])[i] = tmp[i];
+        }
+        GEN_EXPORT_BINDING_WRAPPED(2, scratch_scale, scale_impl);
+
+        TEST(scratch, wrapped) {
+            double field[2][3] = {{0, 1, 2}, {3, 4, 5}};
+            gen_fortran_array_descriptor descriptor{gen_fk_Double, 2, {3, 2}, &field[0][0], false};
+            scratch_scale(&descriptor, 2);
+            for (int i = 0; i < 6; ++i)
+                EXPECT_EQ((&field[0][0])[i], 2 * i);
+        }
+
+        const char expected_c_interface[] = R"?(// This file is generated!
+#pragma once
+
+#include <cpp_bindgen/array_descriptor.h>
+#include <cpp_bindgen/c_attributes.h>
+#include <cpp_bindgen/handle.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int scratch_nested(int);
+void scratch_scale(gen_fortran_array_descriptor*, double) GEN_NONNULL(1);
+int scratch_sum(int);
+
+#ifdef __cplusplus
+}
+#endif
+)?";
+
+        TEST(scratch, c_interface) {
+            std::ostringstream strm;
+            generate_c_interface(strm);
+            EXPECT_EQ(strm.str(), expected_c_interface);
+        }
+
+        const char expected_fortran_interface[] = R"?(! This file is generated!
+module my_module
+implicit none
+  interface
+
+    integer(c_int) function scratch_nested(arg0) bind(c)
+      use iso_c_binding
+      integer(c_int), value :: arg0
+    end function
+    subroutine scratch_scale_impl(arg0, arg1) bind(c, name="scratch_scale")
+      use iso_c_binding
+      use gen_array_descriptor
+      type(gen_fortran_array_descriptor) :: arg0
+      real(c_double), value :: arg1
+    end subroutine
+    integer(c_int) function scratch_sum(arg0) bind(c)
+      use iso_c_binding
+      integer(c_int), value :: arg0
+    end function
+
+  end interface
+contains
+    subroutine scratch_scale(arg0, arg1)
+      use iso_c_binding
+      use gen_array_descriptor
+      real(c_double), dimension(:,:), contiguous, intent(inout), target :: arg0
+      real(c_double), value :: arg1
+      type(gen_fortran_array_descriptor) :: descriptor0
+
+      if (any(shape(arg0) /= (/3, 2/))) error stop "scratch_scale: arg0 has the wrong shape"
+
+      descriptor0%rank = 2
+      descriptor0%type = 6
+      descriptor0%dims = reshape(shape(arg0), &
+        shape(descriptor0%dims), (/0/))
+      descriptor0%data = c_loc(arg0(lbound(arg0, 1),lbound(arg0, 2)))
+
+      call scratch_scale_impl(descriptor0, arg1)
+    end subroutine
+end
+)?";
+
+        TEST(scratch, fortran_interface) {
+            std::ostringstream strm;
+            generate_fortran_interface(strm, "my_module");
+            EXPECT_EQ(strm.str(), expected_fortran_interface);
+        }
+    } // namespace
+} // namespace cpp_bindgen
@@ -0,0 +1,93 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#define CPP_BINDGEN_TRACE
+#include <cpp_bindgen/export.hpp>
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <cpp_bindgen/trace.h>
+
+namespace {
+    int twice_impl(int val) { return 2 * val; }
+    GEN_EXPORT_BINDING_1(twice, twice_impl);
+
+    std::string read_trace() {
+        std::ifstream file("test_trace.json");
+        std::stringstream strm;
+        strm << file.rdbuf();
+        return strm.str();
+    }
+
+    int count(std::string const &str, std::string const &pattern) {
+        int res = 0;
+        for (auto pos = str.find(pattern); pos != std::string::npos; pos = str.find(pattern, pos + 1))
+            ++res;
+        return res;
+    }
+
+    TEST(trace, events) {
+        setenv("GEN_TRACE_FILE", "test_trace.json", 1);
+        setenv("GEN_TRACE_BUFFER_SIZE", "4", 1);
+        gen_trace_begin("phase \"one\"");
+        EXPECT_EQ(4, twice(2));
+        std::thread([] { twice(3); }).join();
+        gen_trace_end();
+        gen_trace_flush();
+
+        auto trace = read_trace();
+        EXPECT_EQ(0, trace.find("[\n{"));
+        EXPECT_EQ(2, count(trace, "\"name\":\"twice\""));
+        EXPECT_EQ(1, count(trace, "\"name\":\"phase \\\"one\\\"\""));
+        EXPECT_EQ(3, count(trace, "\"ph\":\"X\""));
+        EXPECT_EQ(3, count(trace, "\"dur\":"));
+        EXPECT_EQ(2, count(trace, "\"tid\":0"));
+        EXPECT_EQ(1, count(trace, "\"tid\":1"));
+        // a range is written when it is closed
+        EXPECT_LT(trace.find("\"name\":\"twice\""), trace.find("\"name\":\"phase"));
+
+        // the buffers are drained by a flush
+        twice(4);
+        gen_trace_flush();
+        trace = read_trace();
+        EXPECT_EQ(3, count(trace, "\"name\":\"twice\""));
+        EXPECT_EQ(4, count(trace, "\"ph\":\"X\""));
+    }
+
+    TEST(trace, wrapped_buffer) {
+        // the buffer of the main thread holds 4 ranges, older ones are dropped as a whole
+        gen_trace_begin("outer");
+        for (int i = 0; i < 10; ++i)
+            twice(i);
+        gen_trace_end();
+        gen_trace_flush();
+
+        auto trace = read_trace();
+        EXPECT_EQ(8, count(trace, "\"ph\":\"X\""));
+        EXPECT_EQ(1, count(trace, "\"name\":\"outer\""));
+        EXPECT_EQ(8, count(trace, "\"dur\":"));
+    }
+
+    TEST(trace, reused_buffer) {
+        // the buffer of an exited thread is reused, its ranges are kept
+        std::thread([] { twice(5); }).join();
+        std::thread([] { twice(6); }).join();
+        gen_trace_flush();
+        auto trace = read_trace();
+        EXPECT_EQ(0, count(trace, "\"tid\":2"));
+        EXPECT_EQ(3, count(trace, "\"tid\":1"));
+    }
+} // namespace
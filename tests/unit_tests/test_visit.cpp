@@ -0,0 +1,93 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2019, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cpp_bindgen/export.hpp>
+#include <cpp_bindgen/visit.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include <gtest/gtest.h>
+
+namespace cpp_bindgen {
+    namespace {
+        static_assert(is_fortran_array_wrappable<descriptor_view<float, 3>>::value, "");
+        static_assert(fortran_view_meta<descriptor_view<float, 3>>::rank == 3, "");
+
+        struct describe_f {
+            template <class T, int Rank>
+            std::string operator()(descriptor_view<T, Rank>) const {
+                return std::to_string(fortran_array_element_kind<T>::value) + ":" + std::to_string(Rank);
+            }
+        };
+
+        TEST(visit, dispatch) {
+            gen_fortran_array_descriptor descriptor{gen_fk_Double, 3, {2, 3, 4}, nullptr, false};
+            EXPECT_EQ(visit(descriptor, describe_f{}), "6:3");
+            descriptor = {gen_fk_SignedChar, 7, {1, 1, 1, 1, 1, 1, 1}, nullptr, false};
+            EXPECT_EQ(visit(descriptor, describe_f{}), "8:7");
+            descriptor = {gen_fk_Bool, 1, {1}, nullptr, false};
+            EXPECT_EQ(visit(descriptor, describe_f{}), "0:1");
+        }
+
+        TEST(visit, unsupported) {
+            gen_fortran_array_descriptor descriptor{gen_fk_Int, 0, {}, nullptr, false};
+            EXPECT_THROW(visit(descriptor, describe_f{}), std::runtime_error);
+            descriptor.rank = 8;
+            EXPECT_THROW(visit(descriptor, describe_f{}), std::runtime_error);
+            descriptor.rank = 1;
+            descriptor.type = gen_fortran_array_kind(42);
+            EXPECT_THROW(visit(descriptor, describe_f{}), std::runtime_error);
+        }
+
+        TEST(descriptor_view, column_major) {
+            int data[3][2] = {{0, 1}, {2, 3}, {4, 5}};
+            gen_fortran_array_descriptor descriptor{gen_fk_Int, 2, {2, 3}, data, false};
+            descriptor_view<int, 2> view(descriptor);
+            EXPECT_EQ(view.size(), 6);
+            EXPECT_EQ(view.extent(0), 2);
+            EXPECT_EQ(view.extent(1), 3);
+            for (int i = 0; i < 2; ++i)
+                for (int j = 0; j < 3; ++j)
+                    EXPECT_EQ(view(i, j), data[j][i]);
+            EXPECT_EQ(&view[5], &data[2][1]);
+
+            EXPECT_THROW((descriptor_view<float, 2>(descriptor)), std::runtime_error);
+            EXPECT_THROW((descriptor_view<int, 3>(descriptor)), std::runtime_error);
+        }
+
+        struct fill_f {
+            double value;
+            template <class T, int Rank>
+            void operator()(descriptor_view<T, Rank> view) const {
+                for (std::size_t i = 0; i < view.size(); ++i)
+                    view[i] = T(value);
+            }
+        };
+
+        void fill_impl(gen_fortran_array_descriptor descriptor, double value) { visit(descriptor, fill_f{value}); }
+        GEN_EXPORT_BINDING_2(visit_fill, fill_impl);
+
+        TEST(visit, binding) {
+            float floats[2][3];
+            long longs[4];
+            gen_fortran_array_descriptor float_descriptor{gen_fk_Float, 2, {3, 2}, floats, false};
+            gen_fortran_array_descriptor long_descriptor{gen_fk_Long, 1, {4}, longs, false};
+            visit_fill(&float_descriptor, 1.5);
+            visit_fill(&long_descriptor, 3);
+            for (auto &&row : floats)
+                for (float x : row)
+                    EXPECT_EQ(x, 1.5f);
+            for (long x : longs)
+                EXPECT_EQ(x, 3);
+        }
+    } // namespace
+} // namespace cpp_bindgen